@@ -52,6 +52,20 @@ if test "${enable_pthread+set}" = "set" ; then
 fi      
 ])
 dnl
+dnl DSDC_SNAPPY
+dnl
+AC_DEFUN([DSDC_SNAPPY],
+[
+AC_ARG_ENABLE(snappy,
+--disable-snappy       Build without snappy compression)
+if test "${enable_snappy}" != "no" ; then
+      AC_CHECK_LIB(snappy, snappy_compress, [
+            AC_DEFINE(HAVE_DSDC_SNAPPY, 1, Snappy compression of objects)
+            LDADD="$LDADD -lsnappy"
+      ])
+fi
+])
+dnl
 dnl Version Hack
 dnl
 AC_DEFUN([DSDC_SET_VERSION],
@@ -69,5 +69,30 @@ extern output_opts_t output_opts;
 
 void
 output_stats(tabbuf_t& b, const str& h, const dsdc_get_stats_single_res_t& res);
+void output_stats(
+    tabbuf_t& b, const str& h, const dsdc_get_stats_single2_res_t& res);
+
+void output_stats_agg(
+    tabbuf_t& b, const str& h, const dsdc_get_stats_agg_res_t& res);
+
+void output_lock_stats(
+    tabbuf_t& b, const str& h, const dsdc_get_lock_stats_res_t& res);
+
+void output_latency_stats(
+    tabbuf_t& b, const str& h, const dsdc_get_latency_stats_res_t& res);
+
+void
+output_hotkeys(tabbuf_t& b, const str& h, const dsdc_get_hotkeys_res_t& res);
+
+void output_mrc(tabbuf_t& b, const str& h, const dsdc_get_mrc_res_t& res);
+
+void
+output_traces(tabbuf_t& b, const str& h, const dsdc_get_traces_res_t& res);
+
+void
+output_profile(tabbuf_t& b, const str& h, const dsdc_get_profile_res_t& res);
+
+void output_loop_stats(
+    tabbuf_t& b, const str& h, const dsdc_get_loop_stats_res_t& res);
 
 #endif /* _DSDC_ADMIN_H_ */
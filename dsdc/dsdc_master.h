@@ -8,6 +8,7 @@
 #include "dsdc_util.h"  // elements common to master and slave
 #include "dsdc_const.h" // constants
 #include "dsdc_ring.h"  // the consistent hash ring
+#include "dsdc_lockring.h" // ...and the lock ring
 
 #include "itree.h"
 #include "ihash.h"
@@ -53,6 +54,11 @@ class dsdcm_client_t : public virtual refcount {
     unregister_slave() {
         _slave = NULL;
     }
+    // another slave registered with our keys, and took our place
+    void
+    set_replaced() {
+        _replaced = true;
+    }
 
   protected:
     dsdcm_client_t(dsdc_master_t* m, int _fd, const str& h);
@@ -69,6 +75,7 @@ class dsdcm_client_t : public virtual refcount {
     ptr<axprt> _x;          // a wrapper around the fd for the client
     ptr<asrv> _asrv;        // async RPC server
     str _hostname;          // hostname / port of client
+    bool _replaced;         // our slave was dropped for another
 };
 
 /**
@@ -99,6 +106,8 @@ class dsdcm_slave_base_t : public aclnt_wrap_t {
     handle_heartbeat() {
         _last_heartbeat = sfs_get_timenow();
     }
+    // drop this slave in favor of a new one with the same keys
+    void replaced();
 
     bool is_dead(); // if no heartbeat, assume dead
 
@@ -107,9 +116,8 @@ class dsdcm_slave_base_t : public aclnt_wrap_t {
     /**
      * insert all of this slave's node into the master hash ring.
      * data servers obviously need nodes so that data can be
-     * routed toward them.  for now, locking is going to be centralized,
-     * so there is no need for lock servers to have node; their insert
-     * operations will be noops..
+     * routed toward them.  lock servers' nodes go on the lock ring
+     * instead, so that locks can be routed toward them.
      */
     void insert_nodes();
     virtual void insert_node(dsdc_master_t* m, dsdc_ring_node_t* n) = 0;
@@ -209,10 +217,16 @@ class dsdc_master_t : public dsdc_app_t {
 
     void insert_lock_server(dsdcm_lock_server_t* ls);
     void remove_lock_server(dsdcm_lock_server_t* ls);
+    // drop the lock servers with any of <keys>
+    void replace_lock_servers(const dsdc_keyset_t& keys);
     void
-    insert_lock_node(dsdc_ring_node_t* node) {}
+    insert_lock_node(dsdc_ring_node_t* node) {
+        _lock_ring.insert(node);
+    }
     void
-    remove_lock_node(dsdc_ring_node_t* node) {}
+    remove_lock_node(dsdc_ring_node_t* node) {
+        _lock_ring.remove(node);
+    }
 
     // given a key, look in the consistent hash ring for a corresponding
     // node, and then get the ptr<aclnt> that corresponds to the remote
@@ -222,10 +236,19 @@ class dsdc_master_t : public dsdc_app_t {
     void handle_get(svccb* b, CLOSURE);
     void handle_remove(svccb* b, CLOSURE);
     void handle_put(svccb* b, CLOSURE);
+    void handle_put5(svccb* b, CLOSURE);
+    void handle_put6(svccb* b, CLOSURE);
+    void handle_atomic(svccb* b, CLOSURE);
+    void handle_mput(svccb* b, CLOSURE);
     void handle_getstate(svccb* b);
     void handle_lock_release(svccb* b);
     void handle_lock_acquire(svccb* b);
+    void handle_lock_acquire2(svccb* b);
+    void handle_lock_renew(svccb* b);
+    void handle_lock_acquire_batch(svccb* b);
+    void handle_lock_release_batch(svccb* b);
     void handle_get_stats(svccb* b, CLOSURE);
+    void handle_get_stats_agg(svccb* b, CLOSURE);
 
     void
     broadcast_newnode(const dsdcx_slave_t& x, dsdcm_slave_t* skip, CLOSURE);
@@ -239,6 +262,12 @@ class dsdc_master_t : public dsdc_app_t {
         return _lock_servers.first;
     }
 
+    // the lock server for lock key <k>, if any
+    aclnt_wrap_t*
+    lock_server_for(const dsdc_key_t& k) {
+        return dsdcl_lock_server_for(_lock_ring, lock_server(), k);
+    }
+
     void watchdog_timer_loop(CLOSURE);
 
     str
@@ -252,15 +281,33 @@ class dsdc_master_t : public dsdc_app_t {
 
   protected:
     void check_all_slaves();
+    void call_stats(dsdcm_slave_t* sl,
+                    u_int32_t proc,
+                    const dsdc_get_stats_single_arg_t* arg,
+                    void* res,
+                    u_int timeout_ms, // 0 for none
+                    callback<void, clnt_stat>::ref cb,
+                    CLOSURE);
     void get_stats(
         dsdc_slave_statistic_t* out,
         const dsdc_get_stats_single_arg_t* arg,
         dsdcm_slave_t* sl,
+        u_int timeout_ms, // 0 for none
         cbv cb,
         CLOSURE);
+    void select_slaves(const dsdc_slaveset_t& s,
+                       vec<dsdcm_slave_t*>* out,
+                       vec<str>* missing);
 
   private:
     void broadcast_deletes(const dsdc_key_t& k, dsdcm_slave_t* skip);
+    void forward_call(
+        ptr<aclnt> cli,
+        u_int32_t procno,
+        const void* in,
+        void* out,
+        const dsdc_deadline_t* deadline,
+        aclnt_cb cb);
 
     int _port;      // the port it should listen on
     int _lfd;       // listen file descriptor
@@ -280,11 +327,14 @@ class dsdc_master_t : public dsdc_app_t {
     // nodes that the slave has, the more load it will bear.
     dsdc_hash_ring_t _hash_ring;
 
-    ptr<dsdcx_state_t> _system_state;   // system state in XDR format
-    ptr<dsdc_key_t> _system_state_hash; // hash of the above
+    ptr<dsdcx_state2_t> _system_state;   // system state in XDR format
+    ptr<dsdc_key_t> _system_state_hash;  // hash of _system_state->state
+    ptr<dsdc_key_t> _system_state2_hash; // ...and of all of it
 
-    // only the first is active, the rest are backups.
+    // lock servers split up the locks by their nodes on the lock ring;
+    // if none have nodes, only the first is active, the rest are backups.
     tailq<dsdcm_lock_server_t, &dsdcm_lock_server_t::_lnk> _lock_servers;
+    dsdc_hash_ring_t _lock_ring;
 };
 
 #endif /* _DSDC_MASTER_H */
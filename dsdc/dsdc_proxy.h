@@ -4,6 +4,7 @@
 #include "dsdc_util.h"
 #include "dsdc_const.h"
 #include "dsdc.h"
+#include "dsdc_shm.h"
 
 #include "itree.h"
 #include "ihash.h"
@@ -34,24 +35,57 @@ class dsdc_proxy_client_t {
 
 //-----------------------------------------------------------------------------
 
+// the proxy end of a shared-memory connection; see dsdc_shm.h
+class dsdc_proxy_shm_cli_t : public dsdc_shm_conn_t {
+  public:
+    dsdc_proxy_shm_cli_t(dsdc_proxy_t* m, int fd, const str& id);
+    static void alloc(dsdc_proxy_t* m, int fd, const str& id);
+
+  private:
+    void hello();
+    void drain();
+    void got(u_int32_t id, ptr<dsdc_get_res_t> res);
+    void done(u_int32_t id, int rc);
+    void reply(u_int32_t id, dsdc_res_t r, const dsdc_obj_t* o = NULL);
+    void shutdown(const str& why);
+
+    dsdc_proxy_t* m_proxy;
+    int m_hello_fd; // until the client's sent its segment
+    ptr<dsdc_proxy_shm_cli_t> m_self;
+};
+
+//-----------------------------------------------------------------------------
+
 class dsdc_proxy_t : public dsdc_app_t {
   public:
-    dsdc_proxy_t(int p = -1) : m_port(p > 0 ? p : dsdc_proxy_port), m_lfd(-1) {
+    dsdc_proxy_t(int p = -1)
+        : m_port(p > 0 ? p : dsdc_proxy_port), m_lfd(-1), m_unix_lfd(-1),
+          m_shm_lfd(-1) {
         m_cli = New refcounted<dsdc_smartcli_t>();
     }
 
     bool init();
     void new_connection();
+    void new_unix_connection();
+    void new_shm_connection();
 
     void handle_get(svccb* b, CLOSURE);
     void handle_remove(svccb* b, CLOSURE);
     void handle_put(svccb* b, CLOSURE);
+    void handle_mput(svccb* b, CLOSURE);
+    void handle_atomic(svccb* b, CLOSURE);
 
     void add_master(const str& m, int port);
 
   protected:
+    friend class dsdc_proxy_shm_cli_t;
+
+    bool unix_init();
+
     int m_port;
     int m_lfd;
+    int m_unix_lfd; // RPC on dsdc_unix_path, if given
+    int m_shm_lfd;  // shared memory on dsdc_unix_path.shm
 
     ptr<dsdc_smartcli_t> m_cli;
 };
@@ -22,6 +22,10 @@
 #include "dsdc_const.h"
 #include "dsdc_stats.h"
 #include "dsdc_format.h"
+#include "dsdc_fast.h"
+#include "dsdc_compress.h"
+#include "dsdc_chunk.h"
+#include "dsdc_shm.h"
 
 typedef dsdc::annotation::base_t annotation_t;
 
@@ -100,6 +104,16 @@ class dsdci_srv_t : public aclnt_wrap_t, public virtual refcount {
     remote_peer_id() const {
         return _key;
     }
+    const str&
+    hostname() const {
+        return _hostname;
+    }
+
+    // if hostname() is really the path of a unix socket
+    bool
+    is_unix() const {
+        return _hostname[0] == '/';
+    }
 
     typedef enum { CONN_NONE, CONN_FAST, CONN_SLOW } conn_state_t;
 
@@ -158,9 +172,35 @@ class dsdci_master_t : public dsdci_retry_srv_t {
 //
 class dsdci_slave_t : public dsdci_srv_t {
   public:
-    dsdci_slave_t(const str& h, int p) : dsdci_srv_t(h, p) {}
+    dsdci_slave_t(const str& h, int p)
+        : dsdci_srv_t(h, p), _fast_port(-1), _fast_busy(false), _codecs(-1),
+          _codecs_busy(false) {}
+
+    // get the fast-path connection to this slave (see dsdc_fast.h),
+    // connecting if need be; NULL if the slave doesn't speak it, or
+    // if someone else is busy connecting.
+    void get_fast(u_int timeout, dsdci_fast_cb_t cb, CLOSURE);
+
+    // codecs this slave will store compressed objects in, as a bitmask
+    // of DSDC_CODEC_MASK()s; 0 until it's been asked, which the first
+    // call kicks off in the background.
+    u_int codecs();
+
+    // ask again about the fast path and compression after reconnecting
+    void eof_hook();
+
     list_entry<dsdci_slave_t> _lnk;
     ihash_entry<dsdci_slave_t> _hlnk;
+
+  private:
+    void ask_codecs(CLOSURE);
+
+    int _fast_port; // -1 if we haven't asked yet
+    bool _fast_busy;
+    ptr<dsdci_fast_conn_t> _fast;
+
+    int _codecs; // -1 if we haven't asked yet
+    bool _codecs_busy;
 };
 
 //
@@ -170,11 +210,21 @@ class dsdci_slave_t : public dsdci_srv_t {
 //
 class dsdci_proxy_t : public dsdci_retry_srv_t {
   public:
-    dsdci_proxy_t(const str& h, int p) : dsdci_retry_srv_t(h, p) {}
+    dsdci_proxy_t(const str& h, int p)
+        : dsdci_retry_srv_t(h, p), _shm_retry(0) {}
     str
     typ() const {
         return "proxy";
     }
+
+    // the shared-memory connection to this proxy (see dsdc_shm.h),
+    // connecting if need be; NULL if it's not on a unix socket, or if
+    // connecting failed lately.
+    ptr<dsdci_shm_conn_t> get_shm(u_int timeout);
+
+  private:
+    ptr<dsdci_shm_conn_t> _shm;
+    time_t _shm_retry; // don't try to connect again before then
 };
 
 template <>
@@ -198,8 +248,10 @@ struct keyfn<dsdci_slave_t, str> {
 // callback type for returning from get() calls below
 typedef callback<void, ptr<dsdc_get_res_t>>::ref dsdc_get_res_cb_t;
 typedef callback<void, ptr<dsdc_mget_res_t>>::ref dsdc_mget_res_cb_t;
+typedef callback<void, ptr<dsdc_mput_res_t>>::ref dsdc_mput_res_cb_t;
 typedef callback<void, ptr<dsdc_lock_acquire_res_t>>::ref
     dsdc_lock_acquire_res_cb_t;
+typedef callback<void, ptr<dsdc_atomic_res_t>>::ref dsdc_atomic_res_cb_t;
 
 class dsdc_smartcli_t;
 
@@ -303,6 +355,12 @@ class dsdc_iface_t {
      * is related to which, the lock server should keep you straight,
      * since it knows that i != j for its lifetime.
      *
+     * Lock IDs also only ever go up, so they can be used as fencing
+     * tokens: give the lock ID with a DSDC_PUT6 (see
+     * dsdc_smartcli_t::put()), and the write is turned away if the
+     * lock has since timed out and been given to someone else who's
+     * written with theirs.
+     *
      * @param k the key to file the lock under
      * @param cb get called back at cb with the status and a Lock ID
      * @param timeout time this lock out after timeout seconds
@@ -334,6 +392,28 @@ class dsdc_iface_t {
     void lock_release(
         const K& k, dsdcl_id_t id, cbi::ptr cb = NULL, bool safe = false);
 
+    /**
+     * @brief Renew the lease on a lock already held.
+     *
+     * Start a held lock's timeout over, so it can be held for longer
+     * than it was acquired for.  The callback gets DSDC_NOTFOUND if the
+     * lock had already timed out, in which case it might well be held
+     * by someone else, and the caller shouldn't write under it.
+     *
+     * @param k the key of the lock to renew
+     * @param id the lock ID held for that key
+     * @param timeout time the lock out that many seconds from now;
+     * 0 for the timeout it was acquired with
+     * @param cb get called back at cb with a status code.
+     * @param safe if on, route the renewal through the master.
+     */
+    void lock_renew(
+        const K& k,
+        dsdcl_id_t id,
+        u_int timeout = 0,
+        cbi::ptr cb = NULL,
+        bool safe = false);
+
     /*
      * @brief figure out slave the key maps to
      *
@@ -349,6 +429,105 @@ class dsdc_iface_t {
 };
 
 #define DSDC_RETRY_ON_STARTUP 0x1
+#define DSDC_HEDGE_REQUESTS 0x2
+#define DSDC_WRITE_BEHIND 0x4
+#define DSDC_FAST_PATH 0x8
+#define DSDC_COMPRESS 0x10
+#define DSDC_CHUNK 0x20
+#define DSDC_SHM 0x40
+
+//
+// dsdci_hedge_t
+//
+//   keeps a sliding window of recent GET latencies as seen by the smart
+//   client, from which it derives the delay after which an unanswered
+//   GET is "hedged" -- that is, sent a second time via the master. Also
+//   counts how those hedges fared:
+//
+//      sent   - hedge requests issued
+//      won    - the hedge answered before the original request did
+//      wasted - the hedge answered too, but the original request
+//               had answered first
+//
+class dsdci_hedge_t {
+  public:
+    dsdci_hedge_t();
+
+    void add_sample(u_int64_t usec);
+    u_int64_t delay_usec();
+
+    void
+    sent() {
+        _n_sent++;
+    }
+    void
+    won() {
+        _n_won++;
+    }
+    void
+    wasted() {
+        _n_wasted++;
+    }
+
+    u_int64_t
+    n_sent() const {
+        return _n_sent;
+    }
+    u_int64_t
+    n_won() const {
+        return _n_won;
+    }
+    u_int64_t
+    n_wasted() const {
+        return _n_wasted;
+    }
+
+  private:
+    void recompute();
+
+    vec<u_int64_t> _samples;
+    size_t _next;
+    size_t _since_recompute;
+    u_int64_t _delay_usec;
+
+    u_int64_t _n_sent, _n_won, _n_wasted;
+};
+
+//
+// dsdci_wb_queue_t
+//
+//   in write-behind mode, the smart client queues up PUTs and REMOVEs
+//   headed for the same slave, and ships them together in one DSDC_MPUT.
+//   Only one MPUT per slave is in flight at a time, so writes to any
+//   given key land in the order they were issued.  Writes that don't
+//   go through the queue wait on it (see wb_wait()) until everything
+//   queued before them has landed.
+//
+//   A queue outlives its client if an MPUT is in flight when the
+//   client goes; _cli is then NULL, and the reply just frees it.
+//
+struct dsdci_wb_queue_t {
+    dsdci_wb_queue_t(const str& id, ptr<aclnt_wrap_t> w, dsdc_smartcli_t* c)
+        : _id(id), _wrap(w), _cli(c), _bytes(0), _tcb(NULL),
+          _inflight(false), _n_queued(0), _n_done(0) {}
+
+    str _id;
+    ptr<aclnt_wrap_t> _wrap;
+    dsdc_smartcli_t* _cli;
+    dsdc_mput_arg_t _ops;
+    vec<cbi::ptr> _cbs;
+    size_t _bytes;
+    timecb_t* _tcb;
+    bool _inflight;
+
+    // writes ever queued, and answered; a waiter goes once _n_done
+    // reaches its _wait_for
+    u_int64_t _n_queued, _n_done;
+    vec<u_int64_t> _wait_for;
+    vec<cbb::ptr> _waiters;
+
+    ihash_entry<dsdci_wb_queue_t> _hlnk;
+};
 
 //
 // dsdc smart client:
@@ -362,7 +541,8 @@ class dsdc_iface_t {
 class dsdc_smartcli_t : public dsdc_system_state_cache_t {
   public:
     dsdc_smartcli_t(u_int o = 0, u_int to = dsdc_rpc_timeout)
-        : _curr_master(NULL), _opts(o), _timeout(to) {}
+        : _curr_master(NULL), _opts(o), _timeout(to),
+          _z_min(dsdci_compress_min_bytes) {}
     ~dsdc_smartcli_t();
 
     // adds a master from a string only, in the form
@@ -375,7 +555,9 @@ class dsdc_smartcli_t : public dsdc_system_state_cache_t {
     bool add_master(const str& hostname, int port);
 
     // add a new dsdc proxy server, if this is specified, then all requests
-    // coming into this smart client will go through it
+    // coming into this smart client will go through it.  A hostname
+    // starting with '/' is the path of a proxy's unix socket (-U), and
+    // the port is ignored.
     bool add_proxy(const str& hostname, int port = -1);
 
     // initialize the smart client; get a callback with a "true" result
@@ -407,26 +589,91 @@ class dsdc_smartcli_t : public dsdc_system_state_cache_t {
     void put(ptr<dsdc_put_arg_t> arg, cbi::ptr cb = NULL, bool safe = false);
     void put(ptr<dsdc_put4_arg_t> arg, cbi::ptr cb = NULL, bool safe = false);
     void put(ptr<dsdc_put3_arg_t> arg, cbi::ptr cb = NULL, bool safe = false);
+    void put(ptr<dsdc_put5_arg_t> arg, cbi::ptr cb = NULL, bool safe = false);
+    // fenced writes; DSDC_STALE if a newer lock's been used on the key.
+    // Writes without a fence aren't held to it, so don't mix the two.
+    void put(ptr<dsdc_put6_arg_t> arg, cbi::ptr cb = NULL, bool safe = false);
+    // ...traced (see dsdc_trace.h); PUT6's are, now and then, anyway
+    void put(ptr<dsdc_put7_arg_t> arg, cbi::ptr cb = NULL, bool safe = false);
+
+    //
+    //   compare-and-swap, counters and appends, done by the slave that
+    //   has the object, with no lock needed; see dsdc_atomic_arg_t.
+    //   Objects are sent as is, never compressed or chunked.
+    //
+    void atomic(
+        ptr<dsdc_atomic_arg_t> arg,
+        dsdc_atomic_res_cb_t cb,
+        bool safe = false,
+        CLOSURE);
+
+    //
+    //   get/mget can be given a deadline (see dsdc_deadline_in()), after
+    //   which the caller no longer cares for an answer.  The request
+    //   fails with DSDC_TIMEOUT if it's not answered by then, and the
+    //   servers along the way won't bother with it either.
+    //
+    //   <trace> puts the get in a trace already going (as a proxy
+    //   does); without one, a few are traced anyway (see dsdc_trace.h).
+    //
     void
     get(ptr<dsdc_key_t> key,
         dsdc_get_res_cb_t cb,
         bool safe = false,
         int time_to_expire = -1,
         const annotation_t* a = NULL,
+        dsdc_deadline_t deadline = 0,
+        const dsdc_trace_t* trace = NULL,
         CLOSURE);
     void remove(ptr<dsdc_key_t> key, cbi::ptr cb = NULL, bool safe = false);
     void
     remove(ptr<dsdc_remove3_arg_t> arg, cbi::ptr cb = NULL, bool safe = false);
-    void mget(ptr<vec<dsdc_key_t>> keys, dsdc_mget_res_cb_t cb);
+    void mget(
+        ptr<vec<dsdc_key_t>> keys,
+        dsdc_mget_res_cb_t cb,
+        dsdc_deadline_t deadline = 0);
+
+    // batch writes: split up by the slave owning each key, with one
+    // MPUT/MREMOVE per slave; one result per write, in the order given.
+    void
+    mput(ptr<dsdc_mput_arg_t> arg, dsdc_mput_res_cb_t cb, bool safe = false);
+    void mremove(
+        ptr<dsdc_mremove_arg_t> arg, dsdc_mput_res_cb_t cb, bool safe = false);
     void lock_acquire(
         ptr<dsdc_lock_acquire_arg_t> arg,
         dsdc_lock_acquire_res_cb_t cb,
-        bool safe = false);
+        bool safe = false,
+        CLOSURE);
+    // with a priority class and a namespace; see dsdc_lock_acquire2_arg_t
+    void lock_acquire2(
+        ptr<dsdc_lock_acquire2_arg_t> arg,
+        dsdc_lock_acquire_res_cb_t cb,
+        bool safe = false,
+        CLOSURE);
     void lock_release(
         ptr<dsdc_lock_release_arg_t> arg,
         cbi::ptr cb = NULL,
         bool safe = false,
         CLOSURE);
+    void lock_renew(
+        ptr<dsdc_lock_renew_arg_t> arg,
+        cbi::ptr cb = NULL,
+        bool safe = false,
+        CLOSURE);
+
+    // Batches of locks, split up by lock server, and all acquired or
+    // none; see dsdc_lockring.h.  Releases get one result per lock, in
+    // the order given.
+    void lock_acquire_batch(
+        ptr<dsdc_lock_acquire_batch_arg_t> arg,
+        dsdc_lock_acquire_batch_res_cb_t cb,
+        bool safe = false,
+        CLOSURE);
+    void lock_release_batch(
+        ptr<dsdc_lock_release_batch_arg_t> arg,
+        dsdc_lock_release_batch_res_cb_t cb,
+        bool safe = false,
+        CLOSURE);
 
     // slightly more automated versions of the above; call xdr2str/str2xdr
     // automatically, and therefore less code for the app designer
@@ -440,7 +687,8 @@ class dsdc_smartcli_t : public dsdc_system_state_cache_t {
         const dsdc_cksum_t* cks = NULL);
 
     template <class T, class A>
-    dsdc_res_t put2_helper(ptr<A> arg, const T& obj, cbi::ptr cb);
+    dsdc_res_t
+    put2_helper(ptr<A> arg, const T& obj, cbi::ptr cb, bool cksum = false);
 
     template <class T>
     void get2(
@@ -480,6 +728,16 @@ class dsdc_smartcli_t : public dsdc_system_state_cache_t {
     template <class K>
     str which_slave3(const K& k);
 
+    // add <delta> to the counter at <k> (negative to decrement),
+    // starting it at <initial> if it's not there and that's given
+    template <class K>
+    void incr3(
+        const K& k,
+        int64_t delta,
+        dsdc_atomic_res_cb_t cb,
+        const int64_t* initial = NULL,
+        bool safe = false);
+
     template <class K>
     void lock_acquire3(
         const K& k,
@@ -493,10 +751,93 @@ class dsdc_smartcli_t : public dsdc_system_state_cache_t {
     void lock_release3(
         const K& k, dsdcl_id_t id, cbi::ptr cb = NULL, bool safe = false);
 
+    template <class K>
+    void lock_renew3(
+        const K& k,
+        dsdcl_id_t id,
+        u_int timeout = 0,
+        cbi::ptr cb = NULL,
+        bool safe = false);
+
     str which_slave(const dsdc_key_t& k);
 
     static bool obj_too_big(const dsdc_obj_t& obj);
 
+    // Hedging of GETs and MGETs is on if the smart client was made with
+    // the DSDC_HEDGE_REQUESTS option.  The counters are kept regardless.
+    bool
+    hedging() const {
+        return (_opts & DSDC_HEDGE_REQUESTS);
+    }
+    const dsdci_hedge_t&
+    hedge_stats() const {
+        return _hedge;
+    }
+
+    // With the DSDC_WRITE_BEHIND option, unsafe put()s and remove()s are
+    // batched per slave for up to dsdci_wb_window_us (or until
+    // dsdci_wb_max_bytes / dsdci_wb_max_ops are queued) before being
+    // sent.  Callbacks still fire with each write's own result.
+    // flush_writes() sends anything queued right away.  Other writes
+    // (safe ones, PUT5 and up, ATOMIC) to a slave with writes queued
+    // wait for those to land first, so a key's writes stay in order.
+    bool
+    write_behind() const {
+        return (_opts & DSDC_WRITE_BEHIND);
+    }
+    void flush_writes();
+
+    // With the DSDC_FAST_PATH option, plain (unsafe, unannotated, no
+    // expiry or deadline) GETs, PUTs and REMOVEs go to slaves over the
+    // fast-path protocol (see dsdc_fast.h) rather than RPC, if they
+    // speak it.  Everything else goes over RPC as usual.
+    bool
+    fast_path() const {
+        return (_opts & DSDC_FAST_PATH);
+    }
+
+    // With the DSDC_COMPRESS option, put()s of objects at least
+    // compress_threshold() bytes big are compressed (see dsdc_compress.h),
+    // if they go straight to a slave that has agreed to store them that
+    // way.  Slaves uncompress them for get()s.  Puts annotated with a
+    // frobber can have a threshold of their own; (size_t)-1 never
+    // compresses.
+    bool
+    compressing() const {
+        return (_opts & DSDC_COMPRESS);
+    }
+    void
+    set_compress_threshold(size_t n) {
+        _z_min = n;
+    }
+#ifndef DSDC_NO_CUPID
+    void
+    set_compress_threshold(ok_frobber_t f, size_t n) {
+        _z_frobber_min.insert(int(f), n);
+    }
+#endif /* DSDC_NO_CUPID */
+    size_t compress_threshold(const dsdc_annotation_t* a = NULL) const;
+    const dsdci_z_stats_t&
+    compress_stats() const {
+        return _z_stats;
+    }
+
+    // With the DSDC_CHUNK option, put()s of objects bigger than
+    // dsdci_chunk_sz (even compressed) are split into chunks, so that
+    // objects beyond dsdc_packet_sz can be stored; see dsdc_chunk.h.
+    bool
+    chunking() const {
+        return (_opts & DSDC_CHUNK);
+    }
+
+    // With the DSDC_SHM option, plain (unsafe, unannotated, no expiry or
+    // deadline) GETs, PUTs and REMOVEs to a proxy on a unix socket go
+    // over shared memory (see dsdc_shm.h) rather than RPC.
+    bool
+    shared_memory() const {
+        return (_opts & DSDC_SHM);
+    }
+
     /**
      * create a templated interface to this dsdc, which will spare you
      * from the xdr2btyes and bytes2xdr involved with the standard
@@ -511,6 +852,14 @@ class dsdc_smartcli_t : public dsdc_system_state_cache_t {
     }
 
   protected:
+    friend struct mget_batch_t;
+    friend class mget_state_t;
+    template <class A>
+    friend class dsdci_mwrite_t;
+
+    template <class A>
+    void mwrite(ptr<A> arg, int proc, dsdc_mput_res_cb_t cb, bool safe);
+
     // calls either with a timeout or no, depending on the value set
     // for '_timeout'
     void rpc_call(
@@ -520,6 +869,15 @@ class dsdc_smartcli_t : public dsdc_system_state_cache_t {
         void* out,
         aclnt_cb cb);
 
+    // as above, but give up by the deadline if there is one
+    void rpc_call(
+        ptr<aclnt> cli,
+        u_int32_t procno,
+        const void* in,
+        void* out,
+        aclnt_cb cb,
+        dsdc_deadline_t deadline);
+
     // fulfill the virtual interface of dsdc_system_cache_t
     ptr<aclnt> get_primary();
     ptr<aclnt_wrap_t> new_wrap(const str& h, int p);
@@ -528,10 +886,105 @@ class dsdc_smartcli_t : public dsdc_system_state_cache_t {
     void pre_construct();
     void post_construct();
 
-    void acquire_cb_1(
-        ptr<dsdc_lock_acquire_arg_t> arg,
-        dsdc_lock_acquire_res_cb_t cb,
-        ptr<aclnt> cli);
+    // write-behind; see smartcli_wb.C
+    struct wb_batch_t;
+    bool wb_enqueue(const dsdc_key_t& k, const dsdc_mput_op_t& op, cbi::ptr cb);
+    void wb_flush(dsdci_wb_queue_t* q);
+    void wb_timer(dsdci_wb_queue_t* q);
+    static void
+    wb_send(dsdci_wb_queue_t* q, ptr<wb_batch_t> b, ptr<aclnt> cli);
+    static void
+    wb_sent(dsdci_wb_queue_t* q, ptr<wb_batch_t> b, clnt_stat err);
+    static void wb_done(dsdci_wb_queue_t* q, size_t n);
+    dsdci_wb_queue_t* wb_pending(const dsdc_key_t& k);
+    void wb_wait(dsdci_wb_queue_t* q, cbb cb);
+    void wb_clear();
+
+    // fast path; see fastcli.C
+    bool
+    fast_ok(bool safe) const {
+        return !safe && fast_path() && !_proxies.size();
+    }
+    // the lookup itself, for get(); doesn't reassemble chunked objects
+    // or uncompress
+    void get_obj(
+        ptr<dsdc_key_t> key,
+        dsdc_get_res_cb_t cb,
+        bool safe,
+        int time_to_expire,
+        const annotation_t* a,
+        dsdc_deadline_t deadline,
+        const dsdc_trace_t* trace,
+        CLOSURE);
+
+    void fast_conn(const dsdc_key_t& k, dsdci_fast_cb_t cb);
+    void
+    fast_put(ptr<dsdc_put_arg_t> arg, cbi::ptr cb, ptr<dsdci_fast_conn_t> c);
+    void
+    fast_remove(ptr<dsdc_key_t> key, cbi::ptr cb, ptr<dsdci_fast_conn_t> c);
+
+    // shared memory to a local proxy, if we're to use it; see shm.C
+    ptr<dsdci_shm_conn_t> shm_conn(bool safe);
+
+    // the slave that owns the key, going by the ring; NULL if none
+    dsdci_slave_t* slave_for(const dsdc_key_t& k);
+
+    // compression; see compress.C.  compress() gives the PUTZ to send
+    // in place of a put, or NULL if it's not worth compressing; the put
+    // itself is left be.
+    ptr<dsdc_putz_arg_t> compress(const dsdc_put_arg_t& a, bool safe);
+    ptr<dsdc_putz_arg_t> compress(const dsdc_put3_arg_t& a, bool safe);
+    ptr<dsdc_putz_arg_t> compress(const dsdc_put4_arg_t& a, bool safe);
+    ptr<dsdc_putz_arg_t> compress(const dsdc_put5_arg_t& a, bool safe);
+    ptr<dsdc_putz_arg_t> compress(const dsdc_put6_arg_t& a, bool safe);
+    ptr<dsdc_putz_arg_t> compress(const dsdc_put7_arg_t& a, bool safe);
+    ptr<dsdc_putz_arg_t> compress_obj(
+        const dsdc_key_t& k,
+        const dsdc_obj_t& o,
+        const dsdc_annotation_t* a,
+        bool safe);
+    void put_z(ptr<dsdc_putz_arg_t> z, cbi::ptr cb, bool wb);
+
+    // chunking; see smartcli_chunk.T
+    template <class A>
+    bool chunk(ptr<A> arg, cbi::ptr cb, bool safe);
+    template <class A>
+    void chunk_cb(ptr<A> arg, cbi::ptr cb, bool safe, int res);
+    void put_chunks(dsdc_obj_t* obj, cbi cb, CLOSURE);
+    void get_manifest(
+        dsdc_key_t k,
+        dsdc_deadline_t deadline,
+        dsdc_get_res_cb_t cb,
+        CLOSURE);
+    void assemble(
+        dsdc_key_t k,
+        ptr<dsdc_get_res_t> res,
+        dsdc_deadline_t deadline,
+        evv_t ev,
+        CLOSURE);
+    void mget_done(
+        ptr<dsdc_mget_res_t> res,
+        dsdc_mget_res_cb_t cb,
+        dsdc_deadline_t deadline,
+        CLOSURE);
+
+    // the lock server for <k> (or the primary master, if <safe>); if
+    // it's down, refresh the system state once, in case a standby has
+    // taken its place
+    void lock_server_cli(
+        dsdc_key_t k,
+        bool safe,
+        event<dsdc_res_t, ptr<aclnt>>::ref ev,
+        CLOSURE);
+
+    // LOCK_ACQUIRE or LOCK_ACQUIRE2 <arg>, for key <k>
+    void lock_acquire_rpc(
+        dsdc_key_t k,
+        u_int32_t procno,
+        const void* arg,
+        bool safe,
+        event<ptr<dsdc_lock_acquire_res_t>>::ref ev,
+        CLOSURE);
 
     //---------------------------------------------------------------------
     // change cache code
@@ -542,8 +995,13 @@ class dsdc_smartcli_t : public dsdc_system_state_cache_t {
     template <class T>
     struct cc_t {
         cc_t() {}
-        cc_t(const dsdc_key_t& k, ptr<T> a, int p, cbi::ptr c)
-            : key(k), arg(a), proc(p), cb(c), res(New refcounted<int>()) {}
+        cc_t(const dsdc_key_t& k,
+             ptr<T> a,
+             int p,
+             cbi::ptr c,
+             dsdc_deadline_t d = 0)
+            : key(k), arg(a), proc(p), cb(c), res(New refcounted<int>()),
+              deadline(d) {}
 
         ~cc_t() {
             if (cb)
@@ -561,14 +1019,25 @@ class dsdc_smartcli_t : public dsdc_system_state_cache_t {
         cbi::ptr cb;
         ptr<aclnt> cli;
         ptr<int> res;
+        dsdc_deadline_t deadline;
     };
 
     template <class T>
-    void change_cache(const dsdc_key_t& k, ptr<T> arg, int, cbi::ptr, bool);
+    void change_cache(
+        const dsdc_key_t& k,
+        ptr<T> arg,
+        int,
+        cbi::ptr,
+        bool,
+        dsdc_deadline_t deadline = 0);
 
     template <class T>
     void change_cache(ptr<cc_t<T>> cc, bool safe);
     template <class T>
+    void change_cache_send(ptr<cc_t<T>> cc, bool safe);
+    template <class T>
+    void change_cache_cb_0(ptr<cc_t<T>> cc, bool safe, bool ok);
+    template <class T>
     void change_cache_cb_2(ptr<cc_t<T>> cc, clnt_stat err);
     template <class T>
     void change_cache_cb_1(ptr<cc_t<T>> cc, ptr<aclnt> cli);
@@ -613,6 +1082,14 @@ class dsdc_smartcli_t : public dsdc_system_state_cache_t {
 
     u_int _opts;
     u_int _timeout;
+    dsdci_hedge_t _hedge;
+
+    ihash<str, dsdci_wb_queue_t, &dsdci_wb_queue_t::_id, &dsdci_wb_queue_t::_hlnk>
+        _wb_queues;
+
+    size_t _z_min;
+    qhash<int, size_t> _z_frobber_min;
+    dsdci_z_stats_t _z_stats;
 };
 
 //-----------------------------------------------------------------------
@@ -654,8 +1131,14 @@ mkkey(dsdc_key_t* k, const T& obj) {
 template <class T>
 void
 dsdc_smartcli_t::change_cache(
-    const dsdc_key_t& k, ptr<T> arg, int proc, cbi::ptr cb, bool safe) {
-    change_cache<T>(New refcounted<cc_t<T>>(k, arg, proc, cb), safe);
+    const dsdc_key_t& k,
+    ptr<T> arg,
+    int proc,
+    cbi::ptr cb,
+    bool safe,
+    dsdc_deadline_t deadline) {
+    change_cache<T>(
+        New refcounted<cc_t<T>>(k, arg, proc, cb, deadline), safe);
 }
 
 template <class T>
@@ -665,7 +1148,10 @@ dsdc_smartcli_t::change_cache_cb_2(ptr<cc_t<T>> cc, clnt_stat err) {
         if (show_debug(DSDC_DBG_LOW)) {
             warn << "RPC error in proc=" << cc->proc << ": " << err << "\n";
         }
-        cc->set_res(DSDC_RPC_ERROR);
+        if (err == RPC_TIMEDOUT && cc->deadline)
+            cc->set_res(DSDC_TIMEOUT);
+        else
+            cc->set_res(DSDC_RPC_ERROR);
     }
 }
 
@@ -676,18 +1162,46 @@ dsdc_smartcli_t::change_cache_cb_1(ptr<cc_t<T>> cc, ptr<aclnt> cli) {
         cc->set_res(DSDC_NONODE);
         return;
     }
+    if (dsdc_deadline_passed(&cc->deadline)) {
+        cc->set_res(DSDC_TIMEOUT);
+        return;
+    }
 
     rpc_call(
         cli,
         cc->proc,
         cc->arg,
         cc->res,
-        wrap(this, &dsdc_smartcli_t::change_cache_cb_2<T>, cc));
+        wrap(this, &dsdc_smartcli_t::change_cache_cb_2<T>, cc),
+        cc->deadline);
 }
 
 template <class T>
 void
 dsdc_smartcli_t::change_cache(ptr<cc_t<T>> cc, bool safe) {
+    dsdci_wb_queue_t* q;
+    if (write_behind() && (q = wb_pending(cc->key))) {
+        wb_wait(
+            q, wrap(this, &dsdc_smartcli_t::change_cache_cb_0<T>, cc, safe));
+    } else {
+        change_cache_send(cc, safe);
+    }
+}
+
+// after the write-behind queue ahead of it
+template <class T>
+void
+dsdc_smartcli_t::change_cache_cb_0(ptr<cc_t<T>> cc, bool safe, bool ok) {
+    if (!ok) {
+        cc->set_res(DSDC_RPC_ERROR);
+        return;
+    }
+    change_cache_send(cc, safe);
+}
+
+template <class T>
+void
+dsdc_smartcli_t::change_cache_send(ptr<cc_t<T>> cc, bool safe) {
     ptr<dsdci_proxy_t> prx;
     if (safe) {
         change_cache_cb_1(cc, get_primary());
@@ -711,19 +1225,58 @@ dsdc_smartcli_t::change_cache(ptr<cc_t<T>> cc, bool safe) {
 
 //-----------------------------------------------------------------------
 
+template <class A>
+bool
+dsdc_smartcli_t::chunk(ptr<A> arg, cbi::ptr cb, bool safe) {
+    if (!chunking() || _proxies.size() || arg->obj.size() <= dsdci_chunk_sz)
+        return false;
+    put_chunks(
+        &arg->obj, wrap(this, &dsdc_smartcli_t::chunk_cb<A>, arg, cb, safe));
+    return true;
+}
+
+// the chunks are in, and arg->obj is now the manifest
+template <class A>
+void
+dsdc_smartcli_t::chunk_cb(ptr<A> arg, cbi::ptr cb, bool safe, int res) {
+    if (res != DSDC_OK) {
+        if (cb)
+            (*cb)(res);
+        return;
+    }
+    ptr<dsdc_put6_arg_t> m = New refcounted<dsdc_put6_arg_t>();
+    dsdc_manifest_put(*arg, &*m);
+    m->obj = arg->obj;
+    change_cache<dsdc_put6_arg_t>(
+        m->key,
+        m,
+        int(DSDC_PUT_MANIFEST),
+        cb,
+        safe,
+        m->deadline ? *m->deadline : 0);
+}
+
+//-----------------------------------------------------------------------
+
 template <class T, class A>
 dsdc_res_t
-dsdc_smartcli_t::put2_helper(ptr<A> arg, const T& obj, cbi::ptr cb) {
-    dsdc_res_t err = DSDC_OK;
-    if (!xdr2bytes(arg->obj, obj)) {
-        err = DSDC_ERRENCODE;
-    } else if (obj_too_big(arg->obj)) {
-        err = DSDC_TOO_BIG;
-    } else {
+dsdc_smartcli_t::put2_helper(
+    ptr<A> arg, const T& obj, cbi::ptr cb, bool cksum) {
+    if (!xdr2bytes(arg->obj, obj))
+        return DSDC_ERRENCODE;
+
+    // too big objects get chunked, if we're chunking...
+    if (!obj_too_big(arg->obj) || (!cksum && chunking())) {
         put(arg, cb, false);
-        err = DSDC_OK;
+        return DSDC_OK;
     }
-    return err;
+
+    // ...and some only fit compressed
+    ptr<dsdc_putz_arg_t> z = compress(*arg, false);
+    if (!z || obj_too_big(z->put.put.obj))
+        return DSDC_TOO_BIG;
+    put_z(z, cb, true);
+    return DSDC_OK;
 }
 
 //-----------------------------------------------------------------------
@@ -744,7 +1297,7 @@ dsdc_smartcli_t::put2(
         annotation_t::to_xdr(a, &arg4->annotation);
         arg4->checksum.alloc();
         *arg4->checksum = *ck;
-        res = put2_helper(arg4, obj, cb);
+        res = put2_helper(arg4, obj, cb, true);
     } else if (a) {
         ptr<dsdc_put3_arg_t> arg3 = New refcounted<dsdc_put3_arg_t>();
         arg3->key = k;
@@ -824,6 +1377,38 @@ dsdc_smartcli_t::lock_release3(
     lock_release(arg, cb, safe);
 }
 
+template <class K>
+void
+dsdc_smartcli_t::lock_renew3(
+    const K& k, dsdcl_id_t id, u_int timeout, cbi::ptr cb, bool safe) {
+    ptr<dsdc_lock_renew_arg_t> arg = New refcounted<dsdc_lock_renew_arg_t>();
+    mkkey<K>(&arg->key, k);
+    arg->lockid = id;
+    arg->timeout = timeout;
+    lock_renew(arg, cb, safe);
+}
+
+template <class K>
+void
+dsdc_smartcli_t::incr3(
+    const K& k,
+    int64_t delta,
+    dsdc_atomic_res_cb_t cb,
+    const int64_t* initial,
+    bool safe) {
+    ptr<dsdc_atomic_arg_t> arg = New refcounted<dsdc_atomic_arg_t>();
+    mkkey<K>(&arg->key, k);
+    arg->op.set_typ(DSDC_ATOMIC_INCR);
+    arg->op.incr->delta = delta;
+    if (initial) {
+        arg->op.incr->initial.alloc();
+        *arg->op.incr->initial = *initial;
+    }
+    atomic(arg, cb, safe);
+}
+
+//-----------------------------------------------------------------------
+
 template <class K>
 void
 dsdc_smartcli_t::lock_acquire3(
@@ -899,6 +1484,13 @@ dsdc_iface_t<K, V>::lock_release(
     _cli->lock_release3(k, id, cb, safe);
 }
 
+template <class K, class V>
+void
+dsdc_iface_t<K, V>::lock_renew(
+    const K& k, dsdcl_id_t id, u_int timeout, cbi::ptr cb, bool safe) {
+    _cli->lock_renew3(k, id, timeout, cb, safe);
+}
+
 //
 //-----------------------------------------------------------------------
 
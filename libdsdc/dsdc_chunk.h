@@ -0,0 +1,48 @@
+// -*- mode: c++; tab-width: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//-----------------------------------------------------------------------
+
+#ifndef _DSDC_CHUNK_H_
+#define _DSDC_CHUNK_H_
+
+#include "async.h"
+#include "dsdc_prot.h"
+
+//
+// Chunked objects.
+//
+//   Smart clients made with DSDC_CHUNK split objects bigger than
+//   dsdci_chunk_sz into chunks, each put under a key of its own, and
+//   then put a manifest (dsdc_chunk_manifest_t) listing them under the
+//   object's key, with PUT_MANIFEST.  The slave marks it as such, and
+//   lookups that find it come back DSDC_CHUNKED, rather than with the
+//   manifest.  get()s and mget()s that get that fetch the manifest with
+//   GET_MANIFEST, then the chunks, in parallel, and put the object back
+//   together, whether or not the option is on.  If any chunk has been
+//   evicted, the object is gone: the lookup comes back DSDC_NOTFOUND,
+//   and the manifest is removed.
+//
+//   Chunks are plain objects, and get fresh random keys on every put,
+//   so readers never mix up chunks from different versions of an
+//   object; the manifest is only put once all of its chunks are in.
+//   When a slave lets go of a manifest -- it's replaced, removed,
+//   expired or evicted -- it has the primary master remove its chunks.
+//
+//   Objects that fit in a chunk once compressed go compressed instead
+//   (see dsdc_compress.h); only the rest are split up.
+//   Checksummed puts aren't chunked, since there'd be no way to check
+//   the checksum against the whole object on the slave, and neither
+//   are puts that go by way of a proxy, which chunks them itself.
+//
+
+bool dsdc_manifest_encode(const dsdc_chunk_manifest_t& m, dsdc_obj_t* o);
+bool dsdc_manifest_decode(const dsdc_obj_t& o, dsdc_chunk_manifest_t* m);
+
+// the PUT_MANIFEST for a put that's been chunked: everything in it but
+// the object
+void dsdc_manifest_put(const dsdc_put_arg_t& a, dsdc_put6_arg_t* m);
+void dsdc_manifest_put(const dsdc_put3_arg_t& a, dsdc_put6_arg_t* m);
+void dsdc_manifest_put(const dsdc_put4_arg_t& a, dsdc_put6_arg_t* m);
+void dsdc_manifest_put(const dsdc_put5_arg_t& a, dsdc_put6_arg_t* m);
+void dsdc_manifest_put(const dsdc_put6_arg_t& a, dsdc_put6_arg_t* m);
+
+#endif /* _DSDC_CHUNK_H_ */
@@ -0,0 +1,70 @@
+// -*- mode: c++; tab-width: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//-----------------------------------------------------------------------
+
+#ifndef _DSDC_COMPRESS_H_
+#define _DSDC_COMPRESS_H_
+
+#include "async.h"
+#include "dsdc_prot.h"
+
+//
+// Compressed objects.
+//
+//   Smart clients made with DSDC_COMPRESS compress big objects before
+//   putting them straight to a slave, and slaves store them as they
+//   come, so the savings are in slave memory and on the way in.  Which
+//   codecs a slave will take is worked out once per connection, with
+//   DSDC_COMPRESSION.  Compressed objects go as PUTZs (or PUTZ writes
+//   in an MPUT), which say which codec they're in; the slave keeps
+//   that with the object, and uncompresses it for any GET, so readers
+//   only ever see what was written.
+//
+//   Only snappy is supported for now, and only if libdsdc was built with
+//   it (HAVE_DSDC_SNAPPY).
+//
+
+#define DSDC_CODEC_MASK(c) (1u << (c))
+
+// bitmask of the codecs this build can read and write
+u_int dsdc_codecs_supported();
+
+// compress <in> into <out>; false, leaving <out> alone, if the codec
+// isn't available or if it wouldn't save at least 1/8th of the size
+bool dsdc_compress(dsdc_codec_t c, const dsdc_obj_t& in, dsdc_obj_t* out);
+
+// uncompress <in>, in codec <c>, into <out>, which should come to
+// <raw_len> bytes; false if it's corrupt, or in a codec we don't have.
+// DSDC_CODEC_NONE copies it as it is.
+bool dsdc_uncompress(
+    dsdc_codec_t c, size_t raw_len, const dsdc_obj_t& in, dsdc_obj_t* out);
+
+//-----------------------------------------------------------------------
+
+//
+// dsdci_z_stats_t
+//
+//   what a smart client's compression has been up to:
+//
+//      compressed   - objects put compressed
+//      skipped      - objects big enough to try, but that didn't compress
+//                     well enough, or went to slaves that won't take them
+//      raw_bytes    - size of the compressed objects before...
+//      stored_bytes - ...and after
+//
+struct dsdci_z_stats_t {
+    dsdci_z_stats_t()
+        : compressed(0), skipped(0), raw_bytes(0), stored_bytes(0) {}
+
+    // raw_bytes / stored_bytes; 1 if nothing's been compressed
+    double
+    ratio() const {
+        return stored_bytes ? double(raw_bytes) / stored_bytes : 1.0;
+    }
+
+    u_int64_t compressed;
+    u_int64_t skipped;
+    u_int64_t raw_bytes;
+    u_int64_t stored_bytes;
+};
+
+#endif /* _DSDC_COMPRESS_H_ */
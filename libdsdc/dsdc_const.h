@@ -11,8 +11,12 @@ extern int dsdc_missed_beats_to_death;
 extern int dsdc_port;
 extern int dsdc_proxy_port;
 extern int dsdc_slave_port;
+extern int dsdcs_fast_port;
+extern size_t dsdcs_fast_max_out;
+extern str dsdc_unix_path;
 extern int dsdc_retry_wait_time;
 extern u_int dsdc_rpc_timeout;
+extern u_int dsdc_deadline_slop_ms;
 
 extern u_int dsdc_slave_nnodes;
 extern size_t dsdc_slave_maxsz;
@@ -20,12 +24,53 @@ extern size_t dsdc_slave_maxsz;
 extern u_int dsdc_packet_sz;
 extern u_int dsdcs_port_attempts;
 extern u_int dsdcl_default_timeout;
+extern u_int dsdcl_max_timeout;
+extern u_int dsdcl_nnodes;
+extern u_int dsdcl_repl_ping_ms;
+extern u_int dsdcl_repl_hold_s;
+extern bool dsdcl_timer_wheel;
+extern size_t dsdcl_max_ns_stats;
 
 extern time_t dsdci_connect_timeout_ms;
+extern u_int dsdci_hedge_percentile;
+extern time_t dsdci_hedge_min_delay_ms;
+extern time_t dsdci_hedge_max_delay_ms;
+extern size_t dsdci_hedge_window;
+extern time_t dsdci_wb_window_us;
+extern size_t dsdci_wb_max_bytes;
+extern size_t dsdci_wb_max_ops;
+extern size_t dsdci_mt_max_readers;
+extern size_t dsdci_compress_min_bytes;
+extern size_t dsdci_chunk_sz;
+extern u_int32_t dsdci_shm_ring_sz;
 extern time_t dsdcm_timer_interval;
 extern int dsdc_aiod2_remote_port;
 
 extern size_t dsdcs_clean_batch;
 extern time_t dsdcs_clean_wait_us;
+extern time_t dsdcs_fence_horizon_s;
+extern size_t dsdcs_fence_table_sz;
+extern size_t dsdcs_hotkeys_sz;
+extern time_t dsdcs_hotkeys_decay_s;
+extern u_int32_t dsdcs_mrc_sample_ppm;
+extern size_t dsdcs_mrc_max_keys;
+extern size_t dsdcs_mrc_max_annotations;
+extern size_t dsdcs_profile_batch;
+extern size_t dsdcs_profile_max_annotations;
+extern size_t dsdcs_chunk_drop_batch;
+
+extern bool dsdc_latency_on;
+extern size_t dsdc_latency_max_annotations;
+extern size_t dsdc_metrics_max_series;
+extern time_t dsdc_metrics_idle_s;
+extern size_t dsdc_metrics_max_conns;
+extern size_t dsdc_stats_dense_ids;
+extern u_int32_t dsdc_trace_sample_ppm;
+extern size_t dsdc_trace_ring_sz;
+extern size_t dsdc_trace_file_buf;
+extern time_t dsdc_loop_tick_ms;
+extern time_t dsdc_loop_window_s;
+extern time_t dsdc_loop_slow_us;
+extern size_t dsdc_loop_n_slowest;
 
 typedef event<int, str>::ref evis_t;
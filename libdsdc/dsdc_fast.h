@@ -0,0 +1,182 @@
+// -*- mode: c++; tab-width: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//-----------------------------------------------------------------------
+
+#ifndef _DSDC_FAST_H_
+#define _DSDC_FAST_H_
+
+#include "async.h"
+#include "arpc.h"
+#include "ihash.h"
+#include "list.h"
+#include "dsdc_prot.h"
+
+//
+// The fast-path protocol.
+//
+//   A lean framed protocol for plain GET / PUT / REMOVE between smart
+//   clients and slaves, which slaves serve on a separate port (see
+//   dsdcs_fast_port and DSDC_FAST_PORT).  There's no RPC header, no
+//   XDR, and no padding; objects go over the wire exactly as stored.
+//   All integers are in network byte order.
+//
+//   Request, 32 bytes followed by <len> bytes of object (PUT only):
+//
+//      u_int8_t  op        dsdc_fast_op_t
+//      u_int8_t  flags     0
+//      u_int16_t pad       0
+//      u_int32_t id        chosen by the client
+//      u_int32_t len
+//      u_int8_t  key[DSDC_KEYSIZE]
+//
+//   Reply, 12 bytes followed by <len> bytes of object (GET hits only):
+//
+//      u_int32_t id        as in the request
+//      int32_t   status    a dsdc_res_t
+//      u_int32_t len
+//
+//   Replies can come back in any order; the client matches them up
+//   by id.  Anything that doesn't parse kills the connection.  A
+//   slave stops reading from a client with dsdcs_fast_max_out bytes
+//   of replies it hasn't taken yet.
+//
+//   Slaves time and count requests as the plain GET / PUT / REMOVE
+//   they stand for (see dsdc_latency.h).  Like those, they carry no
+//   annotation, and they're never traced.
+//
+
+typedef enum {
+    DSDC_FAST_GET = 1,
+    DSDC_FAST_PUT = 2,
+    DSDC_FAST_REMOVE = 3
+} dsdc_fast_op_t;
+
+#define DSDC_FAST_REQ_HDRSZ (12 + DSDC_KEYSIZE)
+#define DSDC_FAST_RES_HDRSZ 12
+
+struct dsdc_fast_req_hdr_t {
+    dsdc_fast_op_t op;
+    u_int32_t id;
+    u_int32_t len;
+    dsdc_key_t key;
+};
+
+struct dsdc_fast_res_hdr_t {
+    u_int32_t id;
+    dsdc_res_t status;
+    u_int32_t len;
+};
+
+void dsdc_fast_encode(const dsdc_fast_req_hdr_t& h, char* buf);
+bool dsdc_fast_decode(const char* buf, dsdc_fast_req_hdr_t* h);
+void dsdc_fast_encode(const dsdc_fast_res_hdr_t& h, char* buf);
+void dsdc_fast_decode(const char* buf, dsdc_fast_res_hdr_t* h);
+
+//-----------------------------------------------------------------------
+
+typedef callback<void, ptr<dsdc_get_res_t>>::ref dsdci_fast_get_cb_t;
+
+//
+// dsdci_fast_reqs_t
+//
+//   What the client ends of fast-path and shared-memory connections
+//   have in common: sending requests, and matching up the replies with
+//   them.  Any number of requests can be outstanding at once.  Requests
+//   that haven't been answered within the timeout (in seconds; 0 for
+//   none), or that are outstanding when the connection dies, fail with
+//   DSDC_RPC_ERROR.
+//
+class dsdci_fast_reqs_t : public virtual refcount {
+  public:
+    void get(const dsdc_key_t& k, dsdci_fast_get_cb_t cb);
+    void put(const dsdc_key_t& k, const dsdc_obj_t& o, cbi::ptr cb);
+    void remove(const dsdc_key_t& k, cbi::ptr cb);
+
+  protected:
+    struct pending_t {
+        pending_t(u_int32_t i, dsdc_fast_op_t o)
+            : id(i), op(o), sent(sfs_get_timenow()) {}
+        u_int32_t id;
+        dsdc_fast_op_t op;
+        time_t sent;
+        dsdci_fast_get_cb_t::ptr gcb;
+        cbi::ptr wcb;
+        ihash_entry<pending_t> _hlnk;
+        tailq_entry<pending_t> _qlnk;
+    };
+
+    // <what> and <peer> are for warnings
+    dsdci_fast_reqs_t(const char* what, const str& peer, u_int timeout);
+    virtual ~dsdci_fast_reqs_t();
+
+    // put a framed request on the wire; false if the connection's dead
+    virtual bool
+    write_req(const char* h, size_t hlen, const char* b, size_t blen) = 0;
+
+    // the request a reply's for; NULL if it's timed out already
+    pending_t*
+    lookup(u_int32_t id) {
+        return _pending[id];
+    }
+    // a GET found its object
+    void found(pending_t* p, ptr<dsdc_get_res_t> res);
+    // fail or finish a request without an object
+    void complete(pending_t* p, dsdc_res_t r, clnt_stat err = RPC_SUCCESS);
+    // the connection's died; fail everything outstanding
+    void fail_all(clnt_stat err);
+
+  private:
+    void send(
+        dsdc_fast_op_t op,
+        const dsdc_key_t& k,
+        const dsdc_obj_t* o,
+        dsdci_fast_get_cb_t::ptr gcb,
+        cbi::ptr wcb);
+    void forget(pending_t* p);
+    void sweep();
+
+    const char* _what;
+    const str _peer;
+    const u_int _timeout;
+    u_int32_t _next_id;
+    timecb_t* _sweep_tcb;
+
+    ihash<u_int32_t, pending_t, &pending_t::id, &pending_t::_hlnk> _pending;
+    tailq<pending_t, &pending_t::_qlnk> _by_age;
+};
+
+//
+// dsdci_fast_conn_t
+//
+//   The client end of one fast-path connection to a slave.
+//
+class dsdci_fast_conn_t : public dsdci_fast_reqs_t {
+  public:
+    dsdci_fast_conn_t(const str& id, int fd, u_int timeout);
+    ~dsdci_fast_conn_t();
+
+    bool
+    is_dead() const {
+        return _fd < 0;
+    }
+
+    // bytes sent and received over all fast-path connections
+    static u_int64_t bytes_out();
+    static u_int64_t bytes_in();
+
+  protected:
+    bool write_req(const char* h, size_t hlen, const char* b, size_t blen);
+
+  private:
+    void readable();
+    void writable();
+    void shutdown(const str& why);
+
+    const str _id;
+    int _fd;
+    suio _in, _out;
+    bool _write_wait;
+};
+
+typedef callback<void, ptr<dsdci_fast_conn_t>>::ref dsdci_fast_cb_t;
+
+#endif /* _DSDC_FAST_H_ */
@@ -0,0 +1,83 @@
+// -*- mode: c++; tab-width: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//-----------------------------------------------------------------------
+
+#ifndef _DSDC_LATENCY_H_
+#define _DSDC_LATENCY_H_
+
+#include "dsdc_prot.h"
+#include "async.h"
+#include "arpc.h"
+#include "dsdc_trace.h"
+
+//
+// Request latency, by procedure and annotation.
+//
+//   Masters, proxies and slaves run with -l (dsdc_latency_on) each time
+//   the requests they serve, in microseconds, in three parts:
+//
+//     queue    - from the first request the event loop got to on this
+//                pass to this one; that is, the time it waited behind
+//                others that came in at the same time
+//     service  - from there to the reply, less the time upstream
+//     upstream - waiting on RPCs to the next tier: slaves, for a
+//                master; masters or slaves, for a proxy
+//
+//   There's a set of histograms for each procedure and annotation
+//   seen, up to dsdc_latency_max_annotations annotations; requests
+//   with others past that count as unannotated.  GET_LATENCY_STATS
+//   returns them.
+//
+//   A traced request (see dsdc_trace.h) gets a span from its timer,
+//   too.
+//
+
+namespace dsdc {
+namespace latency {
+
+    // One request being timed; handlers that twait keep it in their
+    // tvars.
+    class timer_t {
+      public:
+        timer_t() : _proc(0), _running(false) {}
+
+        // call before looking at the request; takes its procedure and
+        // annotation (if any) from <sbp>
+        void start(svccb* sbp);
+        // ...for requests that aren't RPCs, as on the fast path
+        void start(u_int proc, const dsdc_annotation_t* a = NULL);
+        void upstream_begin();
+        void upstream_end();
+        // record the request; call it whether or not a reply goes out
+        void finish();
+        void
+        cancel() {
+            _running = false;
+        }
+        // the request's span, to pass the trace on from
+        const trace::span_t&
+        span() const {
+            return _span;
+        }
+
+      private:
+        u_int _proc;
+        str _an;
+        bool _running;
+        struct timespec _start, _up_start;
+        int64_t _queue_us, _upstream_us;
+        bool _upstream;
+        trace::span_t _span;
+    };
+
+    // the annotation a request came with, or NULL for none
+    const dsdc_annotation_t* annotation_of(svccb* sbp);
+
+    // reply to GET_LATENCY_STATS
+    void get_stats(svccb* sbp);
+
+    // forget everything timed so far
+    void reset();
+};
+};
+
+#endif /* _DSDC_LATENCY_H_ */
@@ -8,14 +8,40 @@
 #include "dsdc_prot.h"
 #include "async.h"
 #include "arpc.h"
+#include "list.h"
 
 typedef u_int64_t dsdcl_id_t;
 typedef callback<void, dsdcl_id_t>::ref cb_lid_t;
 
+namespace dsdc {
+namespace stats {
+    struct histogram_t;
+};
+};
+
+//
+// How a lock picks among its waiters once it's free.  Whatever the
+// policy, waiters in a higher priority class go first; the policy only
+// settles things between readers and writers of the same class.
+//
+typedef enum {
+    DSDCL_FIFO = 0,        // first come, first served; readers barge in
+    DSDCL_WRITER_PREF = 1, // waiting writers go before waiting readers
+    DSDCL_PHASE_FAIR = 2   // all waiting readers, then a writer, in turn
+} dsdcl_policy_t;
+
+// what acquirers pass along, besides the lock they want
+struct dsdcl_req_t {
+    dsdcl_req_t(u_int p = 0, u_int n = 0) : priority(p), ns(n) {}
+    u_int priority;
+    u_int ns; // for stats; see dsdc_lock_acquire2_arg_t
+};
+
 class dsdcl_waiter_t {
   public:
-    dsdcl_waiter_t(bool w, u_int to, cb_lid_t c)
-        : _writer(w), _timeout(to), _cb(c) {}
+    dsdcl_waiter_t(bool w, u_int to, const dsdcl_req_t& r, cb_lid_t c)
+        : _writer(w), _timeout(to), _req(r), _since(sfs_get_tsnow()),
+          _cb(c) {}
     ~dsdcl_waiter_t();
     bool
     is_writer() const {
@@ -25,27 +51,50 @@ class dsdcl_waiter_t {
     timeout() const {
         return _timeout;
     }
+    const dsdcl_req_t&
+    req() const {
+        return _req;
+    }
+    u_int
+    priority() const {
+        return _req.priority;
+    }
+    const struct timespec&
+    since() const {
+        return _since;
+    }
     void got_lock(dsdcl_id_t i);
     tailq_entry<dsdcl_waiter_t> _lnk;
+    // on the lock's _r_waiters or _w_waiters, by whether we're a writer
     tailq_entry<dsdcl_waiter_t> _r_lnk;
 
   private:
     bool _writer;
     u_int _timeout;
+    dsdcl_req_t _req;
+    struct timespec _since; // when we started waiting
     cb_lid_t::ptr _cb;
 };
 
+class dsdc_lock_t;
+class dsdcl_wheel_t;
+
 class dsdcl_holder_t {
   public:
     dsdcl_holder_t(dsdcl_id_t i, bool w, u_int timeout = 0);
     dsdcl_id_t _id;
     ihash_entry<dsdcl_holder_t> _hlnk;
-    void set_timeout(cbv::ptr cb);
+    // start the lease; <l> hears when it's up.  On <w>, unless
+    // dsdcl_timer_wheel is off, in which case it's a timecb of its own.
+    void set_timeout(dsdc_lock_t* l, dsdcl_wheel_t* w);
+    // start the lease over, for <timeout> seconds (or as many as before)
+    void renew(u_int timeout);
     ptr<bool>
     destroyed_flag() {
         return _destroyed;
     }
     void cancel_timeout();
+    void expire();
     bool
     is_writer() const {
         return _writer;
@@ -54,8 +103,26 @@ class dsdcl_holder_t {
     id() const {
         return _id;
     }
+    u_int
+    timeout() const {
+        return _timeout;
+    }
+    // seconds left on the lease, but at least 1
+    u_int remaining() const;
+
+    // for stats: the namespace, and when the lock was granted
+    u_int _ns;
+    struct timespec _granted;
+
+    // for dsdcl_wheel_t
+    list_entry<dsdcl_holder_t> _wlnk;
+    time_t _expires; // tick the lease is up at; 0 if not on the wheel
 
   private:
+    void start_timer();
+
+    dsdc_lock_t* _lock;
+    dsdcl_wheel_t* _wheel; // NULL if we're on a timecb
     timecb_t* _timer;
     bool _writer;
     time_t _timein;
@@ -63,7 +130,65 @@ class dsdcl_holder_t {
     ptr<bool> _destroyed;
 };
 
+//
+// dsdcl_wheel_t
+//
+//   A hierarchical timer wheel for lock leases, with a tick a second.
+//   Holders are linked right into its slots, so starting and stopping
+//   a lease is O(1) and allocates nothing, and there's only ever the
+//   one timecb, for the next tick.  Leases up in under 256 ticks go in
+//   the first level, a slot per tick; longer ones go in the coarser
+//   levels above, and are cascaded down as they come due.  A lease is
+//   never up early, and up to a couple of seconds late.
+//
+class dsdcl_wheel_t {
+  public:
+    dsdcl_wheel_t();
+    ~dsdcl_wheel_t();
+    // expire <h> in <sec> seconds
+    void insert(dsdcl_holder_t* h, u_int sec);
+    void remove(dsdcl_holder_t* h);
+    size_t
+    size() const {
+        return _n;
+    }
+
+  private:
+    enum {
+        L0_BITS = 8,
+        LN_BITS = 6,
+        NLEVELS = 4 // all told, 2^26 seconds, or two years
+    };
+    typedef list<dsdcl_holder_t, &dsdcl_holder_t::_wlnk> slot_t;
+
+    void place(dsdcl_holder_t* h);
+    size_t cascade(int lev);
+    void tick();
+    void timer();
+
+    slot_t _l0[1 << L0_BITS];
+    slot_t _ln[NLEVELS - 1][1 << LN_BITS];
+    slot_t _far; // further out than all that
+    time_t _now; // every tick up to here has run
+    size_t _n;
+    timecb_t* _tcb;
+};
+
 class dsdcl_mgr_t;
+struct dsdcl_batch_t;
+
+// wait and hold times for one namespace of locks
+struct dsdcl_ns_stats_t {
+    dsdcl_ns_stats_t(u_int ns);
+    ~dsdcl_ns_stats_t();
+    void reset();
+
+    u_int _ns;
+    u_int64_t _acquires, _waits, _timeouts;
+    dsdc::stats::histogram_t* _wait_ms;
+    dsdc::stats::histogram_t* _hold_ms;
+    ihash_entry<dsdcl_ns_stats_t> _hlnk;
+};
 
 class dsdc_lock_t {
   public:
@@ -71,10 +196,24 @@ class dsdc_lock_t {
     ~dsdc_lock_t();
     dsdc_key_t _key;
     ihash_entry<dsdc_lock_t> _hlnk;
-    dsdcl_id_t acquire_noblock(bool writer, u_int timeout);
-    void acquire(bool writer, u_int timeout, cb_lid_t cb);
+    dsdcl_id_t acquire_noblock(
+        bool writer, u_int timeout, const dsdcl_req_t& r = dsdcl_req_t());
+    void acquire(
+        bool writer,
+        u_int timeout,
+        cb_lid_t cb,
+        const dsdcl_req_t& r = dsdcl_req_t());
     bool release(dsdcl_id_t l);
-    void remove_holder(dsdcl_holder_t* h, ptr<bool> df, bool timed_out);
+    bool renew(dsdcl_id_t l, u_int timeout);
+
+    // for standbys: hold the lock under the ID the primary gave it
+    void install(dsdcl_id_t id, bool writer, u_int timeout);
+    // grants for all the current holders, for a standby
+    void snapshot(vec<dsdc_lock_repl_op_t>* out);
+
+    void remove_holder(dsdcl_holder_t* h, bool timed_out);
+    // tell all the waiters they won't get the lock
+    void drop_waiters();
     bool is_locked() const;
     void process_queue();
     void
@@ -83,8 +222,14 @@ class dsdc_lock_t {
     }
 
   private:
-    dsdcl_holder_t* new_holder(bool w, u_int timeout);
+    dsdcl_holder_t* new_holder(bool w, u_int timeout, const dsdcl_req_t& r);
+    void add_holder(dsdcl_holder_t* h);
+    dsdcl_holder_t* find_holder(dsdcl_id_t l);
     dsdcl_holder_t* waiter_to_holder(dsdcl_waiter_t* w);
+    void drop_holder(dsdcl_holder_t* h, bool timed_out);
+    bool reader_must_queue(u_int prio) const;
+    void grant_readers(u_int prio);
+    dsdcl_waiter_t* first_writer(u_int prio);
 
     // If a writer holds the lock, it is exclusively set here
     dsdcl_holder_t* _writer;
@@ -103,6 +248,12 @@ class dsdc_lock_t {
     // list of just the waiters for a shared/read lock
     tailq<dsdcl_waiter_t, &dsdcl_waiter_t::_r_lnk> _r_waiters;
 
+    // and of just the waiters for an exclusive/write lock
+    tailq<dsdcl_waiter_t, &dsdcl_waiter_t::_r_lnk> _w_waiters;
+
+    // for DSDCL_PHASE_FAIR: if the last waiters served were a writer
+    bool _write_phase;
+
     ptr<bool> _destroyed;
     dsdcl_mgr_t* _mgr;
 
@@ -119,22 +270,83 @@ class dsdc_lock_t {
  * to acquire it or just to return without it. Useful for serializing
  * access to DSDC for more complex data structures.
  *
- * All locks timeout after a given interval, which can be set arbitrarily
- * high on a per-lock basis with the acquire call.
+ * All locks timeout after a given interval, which can be set per lock
+ * with the acquire call, up to dsdcl_max_timeout (so that a lock server
+ * handing locks over knows how long they could be held; see
+ * dsdc_lockring.h).  A holder can renew()
+ * its lease before then to keep the lock.  Leases all run on the one
+ * timer wheel, _wheel.
+ *
+ * Lock IDs only ever go up, even across restarts of the lock server
+ * (they start from the time in microseconds), so they double as
+ * fencing tokens: a slave given one with a write (see DSDC_PUT6)
+ * turns the write away if it's seen a newer one for that key.
  *
  * The interface is via the acquire(), release() pair, who in turn
- * follow the interface given in dsdc_prot.x
+ * follow the interface given in dsdc_prot.x.  acquire_batch() and
+ * release_batch() do the same for many keys at once; a batch's locks
+ * are taken one at a time, in key order, and if one can't be had
+ * (without blocking, or at all), the ones already taken are let go.
+ *
+ * Waiters are served by priority class, and then by the fairness
+ * policy (see dsdcl_policy_t); FIFO unless set_policy() says
+ * otherwise.  With stats on (set_lock_stats()), the manager keeps
+ * histograms of how long acquirers waited and how long locks were
+ * held, by namespace, for DSDC_GET_LOCK_STATS.
+ *
+ * Subclasses can replicate the locks elsewhere: replicate() hears of
+ * every grant, release and renewal, and replies that hand out or renew
+ * locks wait on sync().  A standby rebuilds the same state with
+ * clear() and apply().
  *
  */
 class dsdcl_mgr_t {
   public:
-    dsdcl_mgr_t() {}
-    ~dsdcl_mgr_t();
+    dsdcl_mgr_t()
+        : _policy(DSDCL_FIFO), _lock_stats(false),
+          _destroyed(New refcounted<bool>(false)) {}
+    virtual ~dsdcl_mgr_t();
     void acquire(svccb* sbp);
+    void acquire2(svccb* sbp);
     void release(svccb* sbp);
+    void renew(svccb* sbp);
+    void acquire_batch(svccb* sbp);
+    void release_batch(svccb* sbp);
+
+    void apply(const dsdc_lock_repl_op_t& op);
+    void clear();
+    void snapshot(vec<dsdc_lock_repl_op_t>* out);
+
+    void
+    set_policy(dsdcl_policy_t p) {
+        _policy = p;
+    }
+    dsdcl_policy_t
+    policy() const {
+        return _policy;
+    }
+    // turning stats off throws away what's been kept so far
+    void set_lock_stats(bool b);
+    void get_lock_stats(svccb* sbp);
 
     friend class dsdc_lock_t;
 
+  protected:
+    virtual void
+    replicate(
+        dsdc_lock_repl_op_type_t t,
+        const dsdc_key_t& k,
+        const dsdcl_holder_t* h) {}
+
+    // call <cb> once everything replicate()d so far is safe
+    virtual void
+    sync(cbv cb) {
+        (*cb)();
+    }
+
+    // fail the waiters on every lock whose key <keep> says no to
+    void drop_waiters(callback<bool, const dsdc_key_t&>::ref keep);
+
   private:
     // dsdc_lock_t should be able to access these, but no one who
     // is just using the public interface to this class.
@@ -142,6 +354,26 @@ class dsdcl_mgr_t {
     find_lock(const dsdc_key_t& k) {
         return _locks[k];
     }
+    dsdc_lock_t* get_lock(const dsdc_key_t& k);
+    dsdc_res_t release(const dsdc_key_t& k, dsdcl_id_t id);
+
+    void batch_step(dsdcl_batch_t* b);
+    void batch_got(dsdcl_batch_t* b, ptr<bool> df, dsdcl_id_t i);
+    void batch_done(dsdcl_batch_t* b, bool ok);
+    void granted(svccb* sbp, ptr<bool> df, dsdcl_id_t i);
+    void acquire(
+        svccb* sbp,
+        const dsdc_key_t& k,
+        bool writer,
+        bool block,
+        u_int timeout,
+        const dsdcl_req_t& r);
+
+    // stats; no-ops unless they're on
+    void note_grant(const dsdcl_holder_t* h, const dsdcl_waiter_t* w);
+    void note_release(const dsdcl_holder_t* h, bool timed_out);
+    dsdcl_ns_stats_t* ns_stats(u_int ns);
+    void clear_lock_stats();
     void
     insert(dsdc_lock_t* l) {
         _locks.insert(l);
@@ -153,6 +385,13 @@ class dsdcl_mgr_t {
 
     ihash<dsdc_key_t, dsdc_lock_t, &dsdc_lock_t::_key, &dsdc_lock_t::_hlnk>
         _locks;
+    dsdcl_wheel_t _wheel;
+    dsdcl_policy_t _policy;
+    bool _lock_stats;
+    ihash<u_int, dsdcl_ns_stats_t, &dsdcl_ns_stats_t::_ns,
+          &dsdcl_ns_stats_t::_hlnk>
+        _ns_stats;
+    ptr<bool> _destroyed;
 };
 
 #endif /* _DSDC_LOCK_H */
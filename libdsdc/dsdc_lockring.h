@@ -0,0 +1,138 @@
+// -*- mode: c++; tab-width: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//-----------------------------------------------------------------------
+
+#ifndef _DSDC_LOCKRING_H_
+#define _DSDC_LOCKRING_H_
+
+#include "dsdc_prot.h"
+#include "dsdc_ring.h"
+#include "async.h"
+#include "tame.h"
+
+//
+// The lock ring.
+//
+//   Lock servers, like slaves, put nodes on a ring of their own, and
+//   a lock lives on the lock server whose node follows its key.  Lock
+//   servers from before there was a lock ring put no nodes on it; if
+//   none have, all locks live on the first lock server, as before.
+//
+//   Both smart clients and masters route locks this way, and split up
+//   batches of them with the functions below.
+//
+//   When the ring changes, locks move from one lock server to another
+//   with nothing held carried over, so the lock servers see to it that
+//   no lock is had twice (see dsdcl_handoff_t): each learns the ring
+//   from the masters, turns away locks whose keys aren't its own with
+//   DSDC_NONODE, and holds off granting the ones that have just become
+//   its own until whatever the old owner granted has run out.  Leases
+//   are capped at dsdcl_max_timeout for this.
+//
+//   Hence the upgrade order: masters (which hand out the ring with
+//   GETSTATE2) before lock servers.  Clients from before the lock ring
+//   send every lock to the first lock server, which now turns away the
+//   ones it doesn't own; they'll want upgrading too.  A client whose
+//   master knows only GETSTATE can't tell where locks live once lock
+//   servers have nodes, and won't guess (see refresh_lock_server()).
+//
+
+typedef callback<void, ptr<dsdc_lock_acquire_batch_res_t>>::ref
+    dsdc_lock_acquire_batch_res_cb_t;
+typedef callback<void, ptr<dsdc_mput_res_t>>::ref
+    dsdc_lock_release_batch_res_cb_t;
+
+// the lock server for <k>: its successor on <ring>, or <dflt> if the
+// ring is empty; NULL if there's none at all
+aclnt_wrap_t* dsdcl_lock_server_for(
+    const dsdc_hash_ring_t& ring, aclnt_wrap_t* dflt, const dsdc_key_t& k);
+
+// Acquire a batch of locks that might live on several lock servers,
+// with one LOCK_ACQUIRE_BATCH to each.  All the locks are had, or
+// none: if any server's share can't be had, the others are released
+// again.  When blocking, the servers are asked one after another, in
+// order of their peer IDs, so that batches that overlap can't
+// deadlock across servers either.
+void dsdcl_acquire_batch(
+    const dsdc_hash_ring_t& ring,
+    aclnt_wrap_t* dflt,
+    ptr<dsdc_lock_acquire_batch_arg_t> arg,
+    dsdc_lock_acquire_batch_res_cb_t cb);
+
+// Release a batch of locks, with one LOCK_RELEASE_BATCH to each lock
+// server; one result per lock, in the order given.
+void dsdcl_release_batch(
+    const dsdc_hash_ring_t& ring,
+    aclnt_wrap_t* dflt,
+    ptr<dsdc_lock_release_batch_arg_t> arg,
+    dsdc_lock_release_batch_res_cb_t cb);
+
+//-----------------------------------------------------------------------
+
+// A lock server's view of the lock ring: which nodes are its own.
+class dsdcl_ring_view_t {
+  public:
+    dsdcl_ring_view_t() : _known(false) {}
+    // the lock ring in <s>, where <mine> are our nodes' keys; with
+    // <without_us>, the ring as it would be with none of them
+    void set(
+        const dsdcx_state2_t& s,
+        const dsdc_keyset_t& mine,
+        bool without_us = false);
+    bool
+    known() const {
+        return _known;
+    }
+    // if <k> falls to one of our nodes; never, if we know no ring
+    bool owns(const dsdc_key_t& k) const;
+
+  private:
+    struct node_t {
+        dsdc_key_t key;
+        bool mine;
+    };
+    vec<node_t> _nodes; // in key order
+    bool _known;
+};
+
+//
+// dsdcl_handoff_t
+//
+//   What a lock server may grant, as the lock ring changes under it.
+//   A key is its to grant if it owns it now, and has owned it under
+//   every ring it's seen within the last handoff_s() seconds: a lock
+//   on a key that's just come over from another lock server could
+//   still be held there, by a lease granted up until that server heard
+//   of the change.  The first ring we see is taken to have changed
+//   from the one without us.
+//
+class dsdcl_handoff_t {
+  public:
+    // a new ring, seen at <now>
+    void set(const dsdcx_state2_t& s, const dsdc_keyset_t& mine, time_t now);
+    bool
+    known() const {
+        return _ring.known();
+    }
+    bool
+    owns(const dsdc_key_t& k) const {
+        return _ring.owns(k);
+    }
+    // DSDC_OK if we can grant the lock on <k> at <now>; DSDC_NONODE if
+    // it isn't ours; DSDC_LOCKED if it's only lately ours, in which case
+    // <until> is when it will be ours to grant
+    dsdc_res_t may_grant(const dsdc_key_t& k, time_t now, time_t* until) const;
+
+    // the longest lease another lock server could have granted, and
+    // how long it might take it to hear of a new ring
+    static time_t handoff_s();
+
+  private:
+    struct past_t {
+        dsdcl_ring_view_t ring;
+        time_t until;
+    };
+    dsdcl_ring_view_t _ring;
+    vec<past_t> _past; // rings within handoff_s() of being replaced
+};
+
+#endif /* _DSDC_LOCKRING_H_ */
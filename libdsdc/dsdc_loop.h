@@ -0,0 +1,65 @@
+// -*- mode: c++; tab-width: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//-----------------------------------------------------------------------
+
+#ifndef _DSDC_LOOP_H_
+#define _DSDC_LOOP_H_
+
+#include "dsdc_prot.h"
+#include "async.h"
+#include "arpc.h"
+
+//
+// How well a daemon's event loop is keeping up.
+//
+//   Every daemon is one libasync loop, so one callback that runs long
+//   holds up everything else, and shows up elsewhere as timeouts.
+//   Once start()'d, a watchdog timer goes off every
+//   dsdc_loop_tick_ms, and how late it is -- the lag -- is how long
+//   the loop was kept from it.  Every dsdc_loop_window_s, the CPU
+//   time used over the wall time gone by is the loop's utilization;
+//   near 100%, it's saturated, and needs more processes or threads.
+//
+//   Work that can run long is timed with a slice_t: RPC dispatch,
+//   each batch of the cleaner and of a profile walk, and rebuilding
+//   the ring.  Those over dsdc_loop_slow_us are counted by what they
+//   were, and the dsdc_loop_n_slowest longest are kept.
+//
+//   GET_LOOP_STATS returns it all (dsdc_admin -W), and the lag,
+//   utilization and slow callbacks are in the metrics, too.
+//
+
+namespace dsdc {
+namespace loop {
+
+    // One stretch of work that doesn't give the loop back; it's timed
+    // from construction, or restart(), to done() or destruction.
+    // <what> should be a string constant.
+    class slice_t {
+      public:
+        slice_t(const char* what, u_int proc = 0);
+        ~slice_t() {
+            done();
+        }
+
+        void restart();
+        void done();
+
+      private:
+        const char* _what;
+        u_int _proc;
+        struct timespec _start;
+        bool _running;
+    };
+
+    // start the watchdog; call once, when the daemon's up
+    void start();
+
+    // reply to GET_LOOP_STATS
+    void get_stats(svccb* sbp);
+
+    // forget the lag, runtimes and slowest so far
+    void reset();
+};
+};
+
+#endif /* _DSDC_LOOP_H_ */
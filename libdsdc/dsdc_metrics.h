@@ -0,0 +1,130 @@
+// -*- mode: c++; tab-width: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//-----------------------------------------------------------------------
+
+#ifndef _DSDC_METRICS_H_
+#define _DSDC_METRICS_H_
+
+#include "async.h"
+#include "ihash.h"
+#include "list.h"
+
+//
+// Metrics for Prometheus to scrape.
+//
+//   Counters and gauges are kept up to date where things happen, and
+//   a scrape just prints them, in the Prometheus text format, so it
+//   costs about as much as the number of series there are.  Metrics
+//   are made once, as statics, by whatever keeps them; only those
+//   that have been touched get printed, so a master doesn't show a
+//   slave's.
+//
+//   With -H <port>, masters, slaves, proxies and aiod2 serve them all
+//   over HTTP on <port>, at any path.
+//
+
+namespace dsdc {
+namespace metrics {
+
+    class metric_t {
+      public:
+        metric_t(const char* name, const char* help, const char* type);
+        virtual ~metric_t();
+
+        // just the samples; the HELP and TYPE lines are done for it
+        virtual void render(strbuf& b) const = 0;
+        void render_all(strbuf& b) const;
+
+        tailq_entry<metric_t> _lnk;
+
+      protected:
+        const char* const _name;
+        const char* const _help;
+        const char* const _type;
+        bool _touched;
+    };
+
+    //-------------------------------------------------------------------
+
+    class counter_t : public metric_t {
+      public:
+        counter_t(const char* name, const char* help)
+            : metric_t(name, help, "counter"), _v(0) {}
+
+        void
+        inc(u_int64_t n = 1) {
+            _v += n;
+            _touched = true;
+        }
+        void render(strbuf& b) const;
+
+      private:
+        u_int64_t _v;
+    };
+
+    //-------------------------------------------------------------------
+
+    class gauge_t : public metric_t {
+      public:
+        gauge_t(const char* name, const char* help)
+            : metric_t(name, help, "gauge"), _v(0) {}
+
+        void
+        set(int64_t v) {
+            _v = v;
+            _touched = true;
+        }
+        void
+        add(int64_t d) {
+            _v += d;
+            _touched = true;
+        }
+        void render(strbuf& b) const;
+
+      private:
+        int64_t _v;
+    };
+
+    //-------------------------------------------------------------------
+
+    // A counter for each set of labels, given already formatted, as
+    // in reason="clean" (see label()).  Past dsdc_metrics_max_series
+    // sets, the rest are all counted under <overflow>.
+    class counter_vec_t : public metric_t {
+      public:
+        counter_vec_t(const char* name, const char* help, const str& overflow);
+        ~counter_vec_t();
+
+        void inc(const str& labels, u_int64_t n = 1);
+        void render(strbuf& b) const;
+
+      private:
+        struct series_t {
+            series_t(const str& l) : labels(l), v(0) {}
+            str labels;
+            u_int64_t v;
+            ihash_entry<series_t> _hlnk;
+        };
+        ihash<str, series_t, &series_t::labels, &series_t::_hlnk> _series;
+        const str _overflow;
+    };
+
+    //-------------------------------------------------------------------
+
+    // <k>="<v>", with <v> escaped as the text format wants
+    str label(const char* k, const str& v);
+
+    // count an RPC to the next tier, made for a client, that failed;
+    // by procedure, in dsdc_rpc_errors_total
+    void rpc_error(u_int proc);
+
+    // Serve all the metrics over HTTP on <port>; false if we can't
+    // listen there.
+    bool listen(int port);
+
+    // whether we're serving them; metrics that cost something to keep
+    // up can skip it if not
+    bool on();
+};
+};
+
+#endif /* _DSDC_METRICS_H_ */
@@ -0,0 +1,141 @@
+// -*- mode: c++; tab-width: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//-----------------------------------------------------------------------
+
+#ifndef _DSDC_MRC_H_
+#define _DSDC_MRC_H_
+
+#include "dsdc_prot.h"
+#include "dsdc_util.h"
+#include "dsdc_stats.h"
+#include "dsdc_stats1.h"
+#include "ihash.h"
+#include "async.h"
+
+//
+// A slave's miss-ratio curve: the hit ratio it would get at other
+// cache sizes, estimated online with SHARDS (Waldspurger et al.,
+// FAST '15).
+//
+//   A key is sampled if a 24-bit hash of its last bytes (not its
+//   first, which place it on the ring) falls under a threshold T;
+//   that's a fixed set of keys, a fraction R = T/2^24 of them, on any
+//   slave whatever its share of the ring, starting at
+//   dsdcs_mrc_sample_ppm per million.  For each sampled lookup, the
+//   bytes of the other sampled keys used since that key's last use,
+//   scaled up by 1/R, plus its own size, is its reuse distance: the
+//   smallest LRU cache it would have hit in.  Distances go into a
+//   histogram (in KB) for all lookups and another for the lookup's
+//   annotation, if stats are on to say what it is.
+//
+//   Recency is kept in a Fenwick tree of object sizes by time slot,
+//   renumbered when the slots run out, so a sampled lookup costs
+//   O(log dsdcs_mrc_max_keys) and others just the threshold test.
+//   Past dsdcs_mrc_max_keys sampled keys, T comes down to the
+//   largest one's hash value and those at or over it are dropped, so
+//   memory stays bounded however many keys there are.
+//
+//   Inserts make a key most recent, and give its size, but aren't
+//   lookups: a miss and the put that follows count once.
+//
+class dsdcs_mrc_t {
+  public:
+    dsdcs_mrc_t();
+    ~dsdcs_mrc_t();
+
+    // a lookup, of an object of <sz> bytes if it's there (else 0)
+    void
+    lookup(const dsdc_key_t& k,
+           const dsdc::annotation::base_t* a,
+           size_t sz) {
+        if (sampled(k))
+            sample(k, a, sz, true);
+    }
+
+    // an insert, of an object of <sz> bytes
+    void
+    insert(const dsdc_key_t& k, size_t sz) {
+        if (sampled(k))
+            sample(k, NULL, sz, false);
+    }
+
+    // the cache's mean object size, for keys first seen on a miss
+    void
+    set_avg_size(size_t avg) {
+        _avg_sz = avg;
+    }
+
+    // the curves, for a cache of <maxsz> bytes
+    void output(const dsdc_get_mrc_arg_t& a,
+                size_t maxsz,
+                dsdc_mrcs_t* out) const;
+    void reset();
+
+  private:
+    enum { HASH_BITS = 24 };
+
+    struct entry_t {
+        entry_t(const dsdc_key_t& k, u_int32_t h)
+            : key(k), t(h), sz(0), slot(0) {}
+        dsdc_key_t key;
+        u_int32_t t; // the key's hash_of()
+        size_t sz;
+        size_t slot; // when it was last used, in _tree
+        ihash_entry<entry_t> _hlnk;
+    };
+
+    struct curve_t {
+        curve_t(const str& k, const dsdc_annotation_t* a)
+            : key(k), refs(0), dist_kb(1) {
+            if (a)
+                annotation = *a;
+            else
+                annotation.set_typ(DSDC_NO_ANNOTATION);
+        }
+        void to_xdr(const vec<u_int64_t>& sizes, dsdc_mrc_t* out) const;
+
+        str key;
+        dsdc_annotation_t annotation;
+        u_int64_t refs;
+        dsdc::stats::histogram_t dist_kb;
+        ihash_entry<curve_t> _hlnk;
+    };
+
+    static u_int32_t hash_of(const dsdc_key_t& k);
+    static bool later_hash(const entry_t* a, const entry_t* b);
+    bool
+    sampled(const dsdc_key_t& k) const {
+        return hash_of(k) < _threshold;
+    }
+    void sample(const dsdc_key_t& k,
+                const dsdc::annotation::base_t* a,
+                size_t sz,
+                bool lookup);
+    void record(const dsdc::annotation::base_t* a, int64_t dist);
+    curve_t* curve_for(const dsdc::annotation::base_t* a);
+    void use(entry_t* e, size_t sz, bool fresh);
+    void shrink();
+    void compact();
+
+    // the Fenwick tree, over slots [0, _tree.size() - 1)
+    void tree_add(size_t slot, int64_t d);
+    int64_t tree_sum(size_t slot) const; // slots [0, slot)
+
+    ihash<dsdc_key_t,
+          entry_t,
+          &entry_t::key,
+          &entry_t::_hlnk,
+          dsdck_hashfn_t,
+          dsdck_equals_t>
+        _entries;
+    vec<entry_t*> _heap;    // by t, largest first
+    vec<entry_t*> _by_slot; // what's in each slot, for compact()
+    vec<int64_t> _tree;
+    size_t _next_slot;
+    u_int32_t _threshold;
+    size_t _avg_sz;
+
+    curve_t _all;
+    ihash<str, curve_t, &curve_t::key, &curve_t::_hlnk> _annotated;
+};
+
+#endif /* _DSDC_MRC_H_ */
@@ -0,0 +1,231 @@
+// -*- mode: c++; tab-width: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//-----------------------------------------------------------------------
+
+#ifndef _DSDC_MT_H_
+#define _DSDC_MT_H_
+
+#include "dsdc.h"
+
+#if HAVE_DSDC_PTHREAD
+
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+//
+// Thread-safe smart client.
+//
+//   dsdc_smartcli_t, like the rest of libasync, assumes it owns the one
+//   and only thread.  A multithreaded service that wants to talk to
+//   dsdc from all of its worker threads should make one of these
+//   instead of a smart client per thread.  It keeps:
+//
+//     - one I/O thread, running the libasync event loop and a normal
+//       dsdc_smartcli_t, so there's one connection per slave and one
+//       GETSTATE poller for the whole process;
+//
+//     - a submission queue, onto which any thread can push requests;
+//       the I/O thread is only poked (via a socketpair) when the queue
+//       goes from empty to nonempty, so requests arriving in a burst
+//       go over in one wakeup;
+//
+//     - an immutable snapshot of the ring, republished by the I/O thread
+//       whenever the ring changes, which any thread can look keys up
+//       in without taking a lock.  Old snapshots are freed once no
+//       reader could still be looking at them (see dsdci_mt_epoch_t).
+//
+//   Since libasync's str and ptr<> refcounts aren't atomic, nothing
+//   that crosses threads here is made of them; objects go back and forth
+//   as std::strings.
+//
+//   The I/O thread runs amain(), so the process must not also be running
+//   libasync on some other thread.  It lives for as long as the process.
+//
+
+//-----------------------------------------------------------------------
+
+//
+// dsdci_mt_ring_t
+//
+//   A flattened, read-only copy of the hash ring: the ring's node keys,
+//   sorted, each pointing at the slave that owns it.
+//
+class dsdci_mt_ring_t {
+  public:
+    dsdci_mt_ring_t(const dsdc_hash_ring_t& ring, u_int64_t v);
+
+    // name ("host:port") of the slave that owns the given key, or
+    // NULL if the ring is empty
+    const std::string* successor(const dsdc_key_t& k) const;
+
+    u_int64_t
+    version() const {
+        return _version;
+    }
+    size_t
+    n_nodes() const {
+        return _nodes.size();
+    }
+
+    // epoch at which this snapshot was replaced; see dsdci_mt_epoch_t
+    u_int64_t _retired;
+
+  private:
+    struct node_t {
+        dsdc_key_t key;
+        size_t slave;
+    };
+
+    std::vector<node_t> _nodes;
+    std::vector<std::string> _slaves;
+    const u_int64_t _version;
+};
+
+//-----------------------------------------------------------------------
+
+//
+// dsdci_mt_epoch_t
+//
+//   Epoch-based reclamation for ring snapshots.  Each reading thread
+//   gets a slot, into which it writes the current global epoch while
+//   it holds a snapshot, and 0 when done.  A snapshot retired at epoch
+//   E can be freed once every busy slot shows an epoch of at least E,
+//   since such readers started after the snapshot was swapped out.
+//
+//   Slots are handed out process-wide, one per thread, up to
+//   dsdci_mt_max_readers; threads beyond that read under a mutex.
+//
+class dsdci_mt_epoch_t {
+  public:
+    static dsdci_mt_epoch_t* get();
+
+    // returns the reader's slot, or -1 if out of slots
+    int enter();
+    void leave(int slot);
+
+    // bump the global epoch, returning the new value
+    u_int64_t advance();
+
+    // the oldest epoch any reader might still be in
+    u_int64_t min_active() const;
+
+  private:
+    dsdci_mt_epoch_t(size_t n);
+    static void init();
+
+    struct slot_t {
+        u_int64_t epoch;
+        char pad[64 - sizeof(u_int64_t)]; // one cache line per reader
+    };
+
+    u_int64_t _global;
+    size_t _n_taken;
+    const size_t _n_slots;
+    slot_t* _slots;
+};
+
+//-----------------------------------------------------------------------
+
+//
+// dsdc_mt_req_t
+//
+//   A request handed to dsdc_mt_smartcli_t::submit().  Subclass it and
+//   implement done(), which is called on the I/O thread once res
+//   (and, for a successful GET, obj) is filled in.  The request is the
+//   caller's; it's not touched after done() is called.
+//
+class dsdc_mt_req_t {
+  public:
+    typedef enum { GET = 1, PUT = 2, REMOVE = 3 } op_t;
+
+    dsdc_mt_req_t(op_t o, const dsdc_key_t& k, bool s = false)
+        : op(o), key(k), safe(s), res(DSDC_OK), _next(NULL) {}
+    virtual ~dsdc_mt_req_t() {}
+
+    virtual void done() = 0;
+
+    op_t op;
+    dsdc_key_t key;
+    std::string obj;
+    bool safe;
+    dsdc_res_t res;
+
+    dsdc_mt_req_t* _next;
+};
+
+//-----------------------------------------------------------------------
+
+class dsdci_mt_io_t;
+
+class dsdc_mt_smartcli_t {
+  public:
+    dsdc_mt_smartcli_t(u_int o = 0, u_int to = dsdc_rpc_timeout);
+
+    // as in dsdc_smartcli_t; call these before start()
+    void add_master(const str& m);
+    void add_proxy(const str& hostname, int port = -1);
+
+    // spawn the I/O thread, and block until its smart client is up
+    // (true) or all masters have failed (false)
+    bool start();
+
+    // hand a request off to the I/O thread; safe from any thread
+    void submit(dsdc_mt_req_t* r);
+
+    // blocking versions of the above; safe from any thread except
+    // the I/O thread itself
+    dsdc_res_t get(const dsdc_key_t& k, std::string* obj, bool safe = false);
+    dsdc_res_t put(const dsdc_key_t& k, const std::string& obj, bool safe = false);
+    dsdc_res_t remove(const dsdc_key_t& k, bool safe = false);
+
+    // lock-free lookups against the latest ring snapshot; "" if the
+    // ring is empty
+    std::string which_slave(const dsdc_key_t& k);
+
+    // bumped every time the ring changes
+    u_int64_t ring_version();
+
+    // called on the I/O thread
+    void publish(const dsdc_hash_ring_t& ring);
+    void run(CLOSURE);
+
+  private:
+    void dispatch();
+    void issue(dsdc_mt_req_t* r);
+    void get_cb(dsdc_mt_req_t* r, ptr<dsdc_get_res_t> res);
+    void write_cb(dsdc_mt_req_t* r, int res);
+    void init_done(bool ok);
+    void reclaim();
+
+    const u_int _opts;
+    const u_int _timeout;
+    vec<str> _masters;
+    vec<std::pair<str, int>> _proxies;
+
+    dsdci_mt_io_t* _io;
+    pthread_t _thread;
+    int _poke_fd; // submitters write a byte here...
+    int _wake_fd; // ...which wakes up the I/O thread here
+
+    // submission queue
+    pthread_mutex_t _q_lock;
+    dsdc_mt_req_t* _q_head;
+    dsdc_mt_req_t* _q_tail;
+
+    // start() waits on this for init_done()
+    pthread_mutex_t _init_lock;
+    pthread_cond_t _init_cond;
+    bool _init_finished;
+    bool _init_ok;
+
+    // the current ring snapshot, and retired ones not yet freed;
+    // _ring_lock is only for readers that didn't get an epoch slot
+    dsdci_mt_ring_t* _ring;
+    std::vector<dsdci_mt_ring_t*> _retired;
+    pthread_mutex_t _ring_lock;
+    u_int64_t _version;
+};
+
+#endif /* HAVE_DSDC_PTHREAD */
+
+#endif /* _DSDC_MT_H_ */
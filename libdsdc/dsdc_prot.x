@@ -67,19 +67,22 @@ enum dsdc_res_t {
   DSDC_REPLACED = 1,            /* Insert succeeded; object replaced */
   DSDC_INSERTED = 2,            /* Insert succeeded; object created */
   DSDC_NOTFOUND = 3,		/* Key lookup failed. */
-  DSDC_NONODE = 4,              /* No slave nodes found in the ring */
+  DSDC_NONODE = 4,              /* No node in the ring (for the key) */
   DSDC_ALREADY_REGISTERED = 5,  /* Second attempt to register */
   DSDC_RPC_ERROR = 6,           /* RPC communication error */
   DSDC_DEAD = 7,                /* Node was found, but is DEAD */
   DSDC_LOCKED = 8,              /* In advisory locking, acquire failed */
-  DSDC_TIMEOUT = 9,             /* Not used yet.... */
+  DSDC_TIMEOUT = 9,             /* Request deadline passed */
   DSDC_ERRDECODE = 10,		/* Error decoding object. */
   DSDC_ERRENCODE = 11,		/* Error encoding object. */
   DSDC_BAD_STATS = 12,          /* Error in statistics collection */
   DSDC_DATA_CHANGED = 13,       /* checksum commit precondition failed */
   DSDC_DATA_DISAPPEARED = 14,   /* as above, but data disappeared */
   DSDC_TOO_BIG = 15,            /* packet was too big; don't send */
-  DSDC_EXPIRED = 16             /* current entry is still in dsdc, but expired */
+  DSDC_EXPIRED = 16,            /* current entry is still in dsdc, but expired */
+  DSDC_STALE = 17,              /* fencing token older than one already seen */
+  DSDC_NOT_COUNTER = 18,        /* INCR of an object that's not a counter */
+  DSDC_CHUNKED = 19             /* object is in chunks; see dsdc_chunk.h */
 };
 
 /*
@@ -120,6 +123,32 @@ struct dsdc_histogram_t {
 	hyper 		total;
 };
 
+/*
+ * Histograms are log-linear (see dsdc::stats::histogram_t).  A
+ * dsdc_histogram2_t is a dsdc_histogram_t, and <sketch> has its nonzero
+ * buckets, so that histograms from several servers can be merged, and
+ * p50/p99/p999 are read off them, to within a bucket (about 3%).
+ * <hist.buckets> spreads the samples evenly over [min, max], for
+ * display, each capped at 2^32 - 1; <sketch> has the full counts.  All
+ * values are times scale_factor.
+ *
+ * dsdc_histogram_t is as it always was, for GET_STATS and
+ * GET_STATS_SINGLE; procs from after sketches return histogram2s.
+ */
+struct dsdc_hist_bucket_t {
+	unsigned	idx;
+	unsigned hyper	count;
+};
+
+struct dsdc_histogram2_t {
+	dsdc_histogram_t hist;
+	hyper		p50;
+	hyper		p99;
+	hyper		p999;
+	unsigned	sketch_bits;      /* histogram_t::SUB_BITS */
+	dsdc_hist_bucket_t sketch<>;
+};
+
 struct dsdc_dataset_t {
 	hyper creations;
 	hyper puts;
@@ -147,6 +176,36 @@ struct dsdc_statistic_t {
 
 typedef dsdc_statistic_t dsdc_statistics_t<>;
 
+/*
+ * As above, with histogram2s, for GET_STATS_SINGLE2 and GET_STATS_AGG.
+ */
+struct dsdc_dataset2_t {
+	hyper creations;
+	hyper puts;
+	hyper missed_gets;
+	hyper missed_removes;
+	hyper rm_explicit;
+	hyper rm_make_room;
+	hyper rm_clean;
+	hyper rm_replace;
+	unsigned duration;
+	dsdc_histogram2_t gets;
+	dsdc_histogram2_t objsz;
+	dsdc_histogram2_t do_gets;
+	dsdc_histogram2_t do_lifetime;
+	dsdc_histogram2_t do_objsz;
+	dsdc_histogram2_t *lifetime;
+	hyper *n_active;
+};
+
+struct dsdc_statistic2_t {
+	dsdc_annotation_t annotation;
+	dsdc_dataset2_t  epoch_data;
+	dsdc_dataset2_t  alltime_data;
+};
+
+typedef dsdc_statistic2_t dsdc_statistics2_t<>;
+
 struct dsdc_dataset_params_t {
 	unsigned lifetime_n_buckets;
 	unsigned gets_n_buckets;
@@ -187,6 +246,13 @@ default:
 	void;
 };
 
+union dsdc_get_stats_single2_res_t switch (dsdc_res_t status) {
+case DSDC_OK:
+	dsdc_statistics2_t stats;
+default:
+	void;
+};
+
 struct dsdc_slave_statistic_t {
 	dsdc_hostname_t   host;
 	dsdc_get_stats_single_res_t stats;
@@ -194,6 +260,223 @@ struct dsdc_slave_statistic_t {
 
 typedef dsdc_slave_statistic_t dsdc_slave_statistics_t<>;
 
+/*
+ * Stats from many slaves, merged on the master by annotation: the
+ * counters added and histograms merged, so the reply's about one
+ * slave's size however many there are.  <failed> are the slaves that
+ * didn't answer in <timeout_ms>, or whose stats couldn't be merged;
+ * <outliers> are those furthest from the rest (see
+ * dsdc_stats_outlier_t), up to <n_outliers> of them.
+ */
+struct dsdc_get_stats_agg_arg_t {
+	dsdc_slaveset_t              hosts;
+	dsdc_get_stats_single_arg_t  getparams;
+	unsigned                     timeout_ms;  /* 0 for the default */
+	unsigned                     n_outliers;
+};
+
+struct dsdc_slave_failure_t {
+	dsdc_hostname_t   host;
+	dsdc_res_t        status;
+};
+
+/*
+ * A slave whose per-epoch <what> (summed over annotations) is
+ * furthest, by ratio, from the median over the slaves merged.
+ */
+struct dsdc_stats_outlier_t {
+	dsdc_hostname_t   host;
+	string            what<>;
+	hyper             value;
+	hyper             median;
+};
+
+struct dsdc_stats_agg_t {
+	unsigned             n_slaves;
+	unsigned             n_merged;
+	dsdc_statistics2_t   stats;
+	dsdc_stats_outlier_t outliers<>;
+	dsdc_slave_failure_t failed<>;
+};
+
+union dsdc_get_stats_agg_res_t switch (dsdc_res_t status) {
+case DSDC_OK:
+	dsdc_stats_agg_t agg;
+default:
+	void;
+};
+
+/*
+ * How long a server's taken over one procedure's requests with one
+ * annotation (DSDC_NO_ANNOTATION for those without, or past the
+ * number of annotations it keeps), in microseconds: queued behind
+ * other requests, serving them itself, and waiting on the next tier
+ * up (slaves, for a master; masters or slaves, for a proxy).  See
+ * dsdc_latency.h.
+ */
+struct dsdc_latency_stat_t {
+	unsigned          proc;
+	dsdc_annotation_t annotation;
+	dsdc_histogram2_t queue;
+	dsdc_histogram2_t service;
+	dsdc_histogram2_t upstream;
+};
+
+struct dsdc_get_latency_stats_arg_t {
+	unsigned n_buckets;
+	bool reset;               // start over once these are sent
+};
+
+union dsdc_get_latency_stats_res_t switch (dsdc_res_t status) {
+case DSDC_OK:
+	dsdc_latency_stat_t stats<>;
+default:
+	void;
+};
+
+/*
+ * The keys a slave's had the most reads or writes of lately (see
+ * dsdcs_hotkeys_t), hottest first.  <count> covers about the last
+ * <window_ms>, and may be up to <error> too high.
+ */
+struct dsdc_hotkey_t {
+	dsdc_key_t        key;
+	unsigned hyper    count;
+	unsigned hyper    error;
+};
+
+struct dsdc_hotkeys_t {
+	unsigned hyper    window_ms;
+	dsdc_hotkey_t     keys<>;
+};
+
+struct dsdc_hotkeys_stats_t {
+	dsdc_hotkeys_t    reads;
+	dsdc_hotkeys_t    writes;
+};
+
+struct dsdc_get_hotkeys_arg_t {
+	unsigned n;               // how many of each
+	bool reset;               // start over once these are sent
+};
+
+union dsdc_get_hotkeys_res_t switch (dsdc_res_t status) {
+case DSDC_OK:
+	dsdc_hotkeys_stats_t hot;
+default:
+	void;
+};
+
+/*
+ * A slave's miss-ratio curves, from SHARDS sampling of the keys it's
+ * asked for (see dsdcs_mrc_t).  For each cache size in <sizes>, <hits>
+ * is how many of the <refs> sampled lookups would have hit in an LRU
+ * cache of that many bytes.  <all> covers every lookup; <annotated>
+ * breaks them down by annotation, when stats are on.
+ */
+struct dsdc_mrc_t {
+	dsdc_annotation_t annotation;
+	unsigned hyper    refs;
+	unsigned hyper    hits<>;
+};
+
+struct dsdc_mrcs_t {
+	unsigned hyper    sizes<>;
+	unsigned hyper    maxsz;        // the slave's own size
+	unsigned          sample_ppm;   // of keys, for now
+	dsdc_mrc_t        all;
+	dsdc_mrc_t        annotated<>;
+};
+
+struct dsdc_get_mrc_arg_t {
+	unsigned n_points;
+	unsigned hyper max_bytes;     // 0 for twice the slave's size
+	bool reset;                   // start over once these are sent
+};
+
+union dsdc_get_mrc_res_t switch (dsdc_res_t status) {
+case DSDC_OK:
+	dsdc_mrcs_t mrc;
+default:
+	void;
+};
+
+/*
+ * What's filling a slave, from a walk over its cache.  Bytes are as
+ * held, key and bookkeeping included; raw_bytes as they'd be were
+ * nothing compressed.  by_size[i] and by_age[i] (in seconds) count
+ * objects under 2^i and at least 2^(i-1); [0] is for 0.  Objects past
+ * the first dsdcs_profile_max_annotations annotations, or with none,
+ * aren't in <annotated>.  The heap figures are malloc's, 0 where it
+ * can't say.
+ */
+struct dsdc_profile_bin_t {
+	unsigned hyper    n_objs;
+	unsigned hyper    bytes;
+	unsigned hyper    raw_bytes;
+};
+
+struct dsdc_profile_annotated_t {
+	dsdc_annotation_t  annotation;
+	dsdc_profile_bin_t bin;
+};
+
+struct dsdc_profile_t {
+	unsigned hyper           walk_ms;      /* how long the walk took */
+	dsdc_profile_bin_t       all;
+	dsdc_profile_annotated_t annotated<>;
+	dsdc_profile_bin_t       by_size<>;
+	dsdc_profile_bin_t       by_age<>;
+	unsigned hyper           n_hashed;     /* objects in the hash table */
+	unsigned hyper           lru_bytes;    /* what the slave counts */
+	unsigned hyper           max_bytes;
+	unsigned hyper           heap_bytes;   /* got from the system */
+	unsigned hyper           heap_in_use;
+	unsigned hyper           heap_free;    /* ...and kept, unused */
+};
+
+union dsdc_get_profile_res_t switch (dsdc_res_t status) {
+case DSDC_OK:
+	dsdc_profile_t profile;
+default:
+	void;
+};
+
+/*
+ * How a daemon's event loop is keeping up; see dsdc_loop.h.  <lag> is
+ * how late its watchdog went off, and <run> how long timed callbacks
+ * ran, both in us.  <busy_permille> is CPU time over wall time in the
+ * last <window_ms>.  <slowest> has the longest callbacks since the
+ * last reset, longest first; <proc> is an RPC's, or 0.
+ */
+struct dsdc_loop_slice_t {
+	string            what<>;
+	unsigned          proc;
+	unsigned          run_us;
+	unsigned hyper    when_us;      /* since the epoch */
+};
+
+struct dsdc_loop_stats_t {
+	dsdc_histogram2_t lag;
+	dsdc_histogram2_t run;
+	unsigned          busy_permille;
+	unsigned hyper    window_ms;
+	unsigned hyper    n_slow;       /* over dsdc_loop_slow_us */
+	dsdc_loop_slice_t slowest<>;
+};
+
+struct dsdc_get_loop_stats_arg_t {
+	unsigned n_buckets;
+	bool reset;               // start over once these are sent
+};
+
+union dsdc_get_loop_stats_res_t switch (dsdc_res_t status) {
+case DSDC_OK:
+	dsdc_loop_stats_t stats;
+default:
+	void;
+};
+
 /*
  * End statistic structures
  *=======================================================================
@@ -271,17 +554,282 @@ struct dsdc_remove3_arg_t {
 	dsdc_annotation_t  annotation;
 };
 
+/*
+ * A request deadline, in milliseconds since the epoch on the client's
+ * clock.  Masters and proxies forward it as is; a slave that sees a
+ * request after its deadline drops it and replies DSDC_TIMEOUT.
+ */
+typedef unsigned hyper dsdc_deadline_t;
+
+struct dsdc_get4_arg_t {
+	dsdc_key_t 	   key;
+    	int 		   time_to_expire;
+	dsdc_annotation_t  annotation;
+	dsdc_deadline_t    *deadline;
+};
+
+struct dsdc_mget4_arg_t {
+	dsdc_get3_arg_t    keys<>;
+	dsdc_deadline_t    *deadline;
+};
+
+struct dsdc_put5_arg_t {
+	dsdc_key_t 		key;
+	dsdc_obj_t 		obj;
+	dsdc_annotation_t       annotation;
+	dsdc_cksum_t		*checksum;
+	dsdc_deadline_t         *deadline;
+};
+
+/*
+ * As PUT5, but fenced: <fence> is the lock ID of a lock held on the
+ * object, which doubles as a fencing token.  The slave remembers the
+ * highest token it's seen for each key, and turns away writes with
+ * older ones (DSDC_STALE), so that a writer whose lock timed out and
+ * went to someone else can't clobber what they've written since.
+ * Only writes with a <fence> are checked: unfenced PUTs, MPUT, the
+ * fast path and ATOMIC still go through, so every writer to a key
+ * that's fenced should fence too.
+ */
+struct dsdc_put6_arg_t {
+	dsdc_key_t 		key;
+	dsdc_obj_t 		obj;
+	dsdc_annotation_t       annotation;
+	dsdc_cksum_t		*checksum;
+	dsdc_deadline_t         *deadline;
+	unsigned hyper          *fence;
+};
+
+/*
+ * Tracing (see dsdc_trace.h).  A traced request carries its trace's
+ * ID and the span that sent it, and each tier it goes through records
+ * a span of its own under that one, if <sampled>.  GET5 and PUT7 are
+ * GET4 and PUT6 with room for it.
+ */
+struct dsdc_trace_t {
+	unsigned hyper     trace_id;
+	unsigned hyper     parent_id;
+	bool               sampled;
+};
+
+struct dsdc_get5_arg_t {
+	dsdc_get4_arg_t    get;
+	dsdc_trace_t       *trace;
+};
+
+struct dsdc_put7_arg_t {
+	dsdc_put6_arg_t    put;
+	dsdc_trace_t       *trace;
+};
+
+/*
+ * Compression codecs that stored objects can be written in; see
+ * dsdc_compress.h.  DSDC_COMPRESSION takes and returns bitmasks of
+ * these (1 << codec).
+ */
+enum dsdc_codec_t {
+	DSDC_CODEC_NONE = 0,
+	DSDC_CODEC_SNAPPY = 1
+};
+
+/*
+ * A compressed write: PUT7, with the object in <codec>, and <raw_len>
+ * bytes long uncompressed.  Checksums are of the uncompressed object.
+ * Only for slaves that have agreed to the codec with DSDC_COMPRESSION;
+ * they give it back uncompressed to any GET.
+ */
+struct dsdc_putz_arg_t {
+	dsdc_put7_arg_t    put;
+	dsdc_codec_t       codec;
+	unsigned           raw_len;
+};
+
+/* ...and as one of an MPUT's writes */
+struct dsdc_mput_z_t {
+	dsdc_put4_arg_t    put;
+	dsdc_codec_t       codec;
+	unsigned           raw_len;
+};
+
+/*
+ * One server's (or client's) part in a traced request, in
+ * microseconds: <total_us> from the request's arrival to the reply,
+ * <upstream_us> of it waiting on the next tier.  These are also the
+ * records in a trace file, one after another.
+ */
+struct dsdc_span_t {
+	unsigned hyper     trace_id;
+	unsigned hyper     span_id;
+	unsigned hyper     parent_id;   /* 0 at the root */
+	unsigned           proc;
+	unsigned hyper     start_us;    /* since the epoch */
+	unsigned           total_us;
+	unsigned           upstream_us;
+};
+
+struct dsdc_get_traces_arg_t {
+	unsigned hyper     trace_id;    /* 0 for all kept */
+	bool               reset;       /* forget them once sent */
+};
+
+union dsdc_get_traces_res_t switch (dsdc_res_t status) {
+case DSDC_OK:
+	dsdc_span_t spans<>;
+default:
+	void;
+};
+
+/*
+ * Multi-put: a batch of writes, applied in order by the slave, with
+ * one result per write.
+ */
+enum dsdc_mput_op_type_t {
+	DSDC_MPUT_PUT = 0,
+	DSDC_MPUT_REMOVE = 1,
+	DSDC_MPUT_PUTZ = 2          /* only to slaves that take the codec */
+};
+
+union dsdc_mput_op_t switch (dsdc_mput_op_type_t typ) {
+case DSDC_MPUT_PUT:
+	dsdc_put4_arg_t put;
+case DSDC_MPUT_REMOVE:
+	dsdc_remove3_arg_t remove;
+case DSDC_MPUT_PUTZ:
+	dsdc_mput_z_t putz;
+};
+
+typedef dsdc_mput_op_t dsdc_mput_arg_t<>;
+typedef dsdc_res_t dsdc_mput_res_t<>;
+typedef dsdc_remove3_arg_t dsdc_mremove_arg_t<>;
+
+/*
+ * Atomic ops, done by the slave in one go, in place of a lock, a get,
+ * a put and an unlock.  Every write to an object on a slave gives it
+ * a new version, which only goes up for as long as the slave's
+ * around; the result of every op has the object's version after it.
+ * Each comes back DSDC_OK when it's done, whether or not it wrote a
+ * new object, and writes keep the object's annotation.
+ *
+ *   READ:   the object (uncompressed) and its version.
+ *   CAS:    write <obj> if the object's unchanged: its checksum or
+ *           version is as expected.  An empty checksum, or version 0,
+ *           expects there to be no object at all.  DSDC_DATA_CHANGED
+ *           or DSDC_DATA_DISAPPEARED otherwise, with the version as it
+ *           stands.
+ *   INCR:   add <delta> to a counter, a 64-bit integer XDR-encoded
+ *           (as a hyper; 8 bytes, big-endian), wrapping on overflow.
+ *           If there's no object, it's started at <initial>, if
+ *           given, before adding; DSDC_NOTFOUND if not.  DECR is INCR
+ *           with a negative delta.  DSDC_NOT_COUNTER if the object's
+ *           not 8 bytes long.
+ *   APPEND: add <data> to the end of the object; DSDC_NOTFOUND if
+ *           there isn't one, and DSDC_TOO_BIG if it would then be
+ *           more than dsdc_packet_sz.
+ *
+ * Objects that were split into chunks (see dsdc_chunk.h) are only
+ * manifests on the slave; all but CAS come back DSDC_CHUNKED for them.
+ */
+enum dsdc_atomic_op_type_t {
+	DSDC_ATOMIC_READ = 0,
+	DSDC_ATOMIC_CAS = 1,
+	DSDC_ATOMIC_INCR = 2,
+	DSDC_ATOMIC_APPEND = 3
+};
+
+enum dsdc_cas_type_t {
+	DSDC_CAS_CHECKSUM = 0,
+	DSDC_CAS_VERSION = 1
+};
+
+union dsdc_cas_expect_t switch (dsdc_cas_type_t typ) {
+case DSDC_CAS_CHECKSUM:
+	dsdc_cksum_t checksum;    /* sha1 of the object, uncompressed */
+case DSDC_CAS_VERSION:
+	unsigned hyper version;
+};
+
+struct dsdc_cas_arg_t {
+	dsdc_cas_expect_t expect;
+	dsdc_obj_t obj;
+};
+
+struct dsdc_incr_arg_t {
+	hyper delta;
+	hyper *initial;
+};
+
+union dsdc_atomic_op_t switch (dsdc_atomic_op_type_t typ) {
+case DSDC_ATOMIC_READ:
+	void;
+case DSDC_ATOMIC_CAS:
+	dsdc_cas_arg_t cas;
+case DSDC_ATOMIC_INCR:
+	dsdc_incr_arg_t incr;
+case DSDC_ATOMIC_APPEND:
+	dsdc_obj_t data;
+};
+
+struct dsdc_atomic_arg_t {
+	dsdc_key_t key;
+	dsdc_atomic_op_t op;
+	dsdc_deadline_t *deadline;
+};
+
+struct dsdc_atomic_res_t {
+	dsdc_res_t status;
+	unsigned hyper version;   /* 0 if there's no object */
+	hyper counter;            /* INCR: the counter, after */
+	dsdc_obj_t *obj;          /* READ: the object */
+};
+
+/*
+ * Stored under an object's key in place of an object too big to go in
+ * one piece, which is instead split over the chunks listed; see
+ * dsdc_chunk.h.  It's written XDR'ed, as the object of a PUT_MANIFEST,
+ * and read back with GET_MANIFEST.
+ */
+struct dsdc_chunk_manifest_t {
+	unsigned size;               /* of the whole object */
+	dsdc_cksum_t cksum;          /* sha1 of the whole object */
+	dsdc_key_t chunks<>;
+};
+
+struct dsdc_compression_res_t {
+	unsigned codecs;             /* what the slave will accept */
+	unsigned hyper n_objs;       /* objects in the cache... */
+	unsigned hyper n_compressed; /* ...and how many are compressed */
+	unsigned hyper stored_bytes; /* bytes of objects, as stored */
+	unsigned hyper raw_bytes;    /* ...and once uncompressed */
+};
+
 struct dsdcx_slave_t {
  	dsdc_keyset_t keys;
 	string hostname<>;
 	int port;
 };
 
+/*
+ * lock_server is the first lock server to have registered, for clients
+ * that only know about one; or, if any lock servers have nodes on the
+ * lock ring, the first of those.  It turns away the locks that aren't
+ * its own (see dsdc_lockring.h for the upgrade order).
+ */
 struct dsdcx_state_t {
 	dsdcx_slave_t slaves<>;
 	dsdcx_slave_t *lock_server;
 };
 
+/*
+ * GETSTATE2's: as for GETSTATE, and all of the lock servers.  Their
+ * keys are their nodes on the lock ring, which is separate from the
+ * slaves' ring.  Lock servers that have no keys only stand in for the
+ * first.
+ */
+struct dsdcx_state2_t {
+	dsdcx_state_t state;
+	dsdcx_slave_t lock_servers<>;
+};
+
 struct dsdc_register_arg_t {
  	dsdcx_slave_t slave;
 	bool primary;
@@ -296,6 +844,13 @@ case false:
 	void;
 };
 
+union dsdc_getstate2_res_t switch (bool needupdate) {
+case true:
+	dsdcx_state2_t state;
+case false:
+	void;
+};
+
 union dsdc_lock_acquire_res_t switch (dsdc_res_t status) {
 case DSDC_OK:
 	unsigned hyper lockid;
@@ -312,11 +867,127 @@ struct dsdc_lock_acquire_arg_t {
 	unsigned timeout;         // how long the lock is held for
 };
 
+/*
+ * As dsdc_lock_acquire_arg_t, for DSDC_LOCK_ACQUIRE2, with a priority
+ * class and a namespace.  Waiters in a higher class are served before
+ * those in a lower one, whatever the lock server's fairness policy
+ * (see dsdcl_policy_t); plain acquires are class 0.  <ns> is the
+ * caller's own number for the kind of thing being locked, and is what
+ * the lock server keeps wait and hold times by (see
+ * DSDC_GET_LOCK_STATS); plain acquires are namespace 0.
+ */
+struct dsdc_lock_acquire2_arg_t {
+	dsdc_key_t key;
+	bool writer;
+	bool block;
+	unsigned timeout;
+	unsigned priority;
+	unsigned ns;
+};
+
 struct dsdc_lock_release_arg_t {
 	dsdc_key_t key;	          // original key that was locked
 	unsigned hyper lockid;    // provide the lock-ID to catch bugs
 };
 
+/*
+ * Extend a lock's lease: it now times out <timeout> seconds from
+ * when the renewal gets to the lock server (0 for the timeout it was
+ * acquired with).  DSDC_NOTFOUND if the lock's no longer held under
+ * that ID, in which case the holder should stop writing.
+ */
+struct dsdc_lock_renew_arg_t {
+	dsdc_key_t key;
+	unsigned hyper lockid;
+	unsigned timeout;
+};
+
+/*
+ * Batches of locks, all taken or none.  The lock server takes them in
+ * key order, whatever order they're given in, so batches that overlap
+ * can't deadlock.  A key given twice is locked once, and gets the same
+ * lock ID both times.
+ */
+struct dsdc_lock_acquire_batch_arg_t {
+	dsdc_key_t keys<>;
+	bool writer;
+	bool block;
+	unsigned timeout;
+};
+
+union dsdc_lock_acquire_batch_res_t switch (dsdc_res_t status) {
+case DSDC_OK:
+	unsigned hyper lockids<>; // one per key, in the order given
+case DSDC_RPC_ERROR:
+	unsigned err;
+default:
+	void;
+};
+
+struct dsdc_lock_release_batch_arg_t {
+	dsdc_lock_release_arg_t locks<>;
+};
+
+/*
+ * Replication from a primary lock server to its standby.  Every
+ * grant, release and renewal is sent along, and replies to clients
+ * that got or renewed locks wait until the standby has them.  The
+ * first update after (re)connecting is a snapshot: reset is set, keys
+ * are the primary's nodes on the lock ring (which the standby takes
+ * over if it's promoted), and ops grant every lock held.  Updates go
+ * at least every dsdcl_repl_ping_ms, empty if need be; a standby that
+ * hears nothing for dsdc_heartbeat_interval takes over.  A standby
+ * that has taken over replies DSDC_ALREADY_REGISTERED.
+ */
+enum dsdc_lock_repl_op_type_t {
+	DSDC_LOCK_REPL_GRANT = 0,
+	DSDC_LOCK_REPL_RELEASE = 1,
+	DSDC_LOCK_REPL_RENEW = 2
+};
+
+struct dsdc_lock_repl_op_t {
+	dsdc_lock_repl_op_type_t typ;
+	dsdc_key_t key;
+	unsigned hyper lockid;
+	bool writer;
+	unsigned timeout;         // seconds left on the lease
+};
+
+struct dsdc_lock_repl_arg_t {
+	bool reset;
+	dsdc_keyset_t keys;
+	dsdc_lock_repl_op_t ops<>;
+};
+
+/*
+ * What the lock server's seen of one namespace of locks since stats
+ * mode was turned on (see DSDC_SET_STATS_MODE), or since the last
+ * reset: how long acquirers waited for locks (0 for those that got
+ * them straight away), and how long locks were then held, both in
+ * milliseconds.  Only the first dsdcl_max_ns_stats namespaces seen
+ * are kept apart; the rest are counted in namespace 0.
+ */
+struct dsdc_lock_ns_stats_t {
+	unsigned ns;
+	hyper acquires;
+	hyper waits;              // acquires that had to queue
+	hyper timeouts;           // leases that ran out before a release
+	dsdc_histogram2_t wait_ms;
+	dsdc_histogram2_t hold_ms;
+};
+
+struct dsdc_get_lock_stats_arg_t {
+	unsigned n_buckets;
+	bool reset;               // start over once these are sent
+};
+
+union dsdc_get_lock_stats_res_t switch (dsdc_res_t status) {
+case DSDC_OK:
+	dsdc_lock_ns_stats_t stats<>;
+default:
+	void;
+};
+
 /* ------------------------------------------------------------- */
 /* aiod2 data */
 
@@ -533,6 +1204,158 @@ program DSDC_PROG
 	 dsdc_res_t
 	 DSDC_PUT4(dsdc_put4_arg_t) = 21;
 
+	/*
+	 * As GET3/MGET3/PUT4, but with an optional deadline.
+	 */
+	 dsdc_get_res_t
+	 DSDC_GET4(dsdc_get4_arg_t) = 22;
+
+	 dsdc_mget_res_t
+	 DSDC_MGET4(dsdc_mget4_arg_t) = 23;
+
+	 dsdc_res_t
+	 DSDC_PUT5(dsdc_put5_arg_t) = 24;
+
+	 dsdc_mput_res_t
+	 DSDC_MPUT(dsdc_mput_arg_t) = 25;
+
+	 dsdc_mput_res_t
+	 DSDC_MREMOVE(dsdc_mremove_arg_t) = 26;
+
+	/*
+	 * The port on which a slave speaks the framed fast-path
+	 * protocol (see dsdc_fast.h), or 0 if it doesn't.
+	 */
+	 int
+	 DSDC_FAST_PORT(void) = 27;
+
+	/*
+	 * Compression negotiation: the client says which codecs it can
+	 * write, and the slave which of those it will take.  Also
+	 * reports how well what's in the cache compresses.
+	 */
+	 dsdc_compression_res_t
+	 DSDC_COMPRESSION(unsigned) = 28;
+
+	/*
+	 * Acquire and release a batch of locks in one go; releases
+	 * get one result per lock, in the order given.
+	 */
+	 dsdc_lock_acquire_batch_res_t
+	 DSDC_LOCK_ACQUIRE_BATCH(dsdc_lock_acquire_batch_arg_t) = 29;
+
+	 dsdc_mput_res_t
+	 DSDC_LOCK_RELEASE_BATCH(dsdc_lock_release_batch_arg_t) = 30;
+
+	/*
+	 * Lock leases and fenced writes; see dsdc_lock_renew_arg_t
+	 * and dsdc_put6_arg_t.
+	 */
+	 dsdc_res_t
+	 DSDC_LOCK_RENEW(dsdc_lock_renew_arg_t) = 31;
+
+	 dsdc_res_t
+	 DSDC_PUT6(dsdc_put6_arg_t) = 32;
+
+	 dsdc_res_t
+	 DSDC_LOCK_REPLICATE(dsdc_lock_repl_arg_t) = 33;
+
+	/*
+	 * LOCK_ACQUIRE with a priority class and a namespace; see
+	 * dsdc_lock_acquire2_arg_t.
+	 */
+	 dsdc_lock_acquire_res_t
+	 DSDC_LOCK_ACQUIRE2(dsdc_lock_acquire2_arg_t) = 34;
+
+	 dsdc_get_lock_stats_res_t
+	 DSDC_GET_LOCK_STATS(dsdc_get_lock_stats_arg_t) = 35;
+
+	/*
+	 * Compare-and-swap, counters and appends; see dsdc_atomic_arg_t.
+	 */
+	 dsdc_atomic_res_t
+	 DSDC_ATOMIC(dsdc_atomic_arg_t) = 36;
+
+	/*
+	 * Request latency, from any master, proxy or slave, about
+	 * itself; see dsdc_latency_stat_t.  Empty unless it's run with -l.
+	 */
+	 dsdc_get_latency_stats_res_t
+	 DSDC_GET_LATENCY_STATS(dsdc_get_latency_stats_arg_t) = 37;
+
+	 dsdc_get_hotkeys_res_t
+	 DSDC_GET_HOTKEYS(dsdc_get_hotkeys_arg_t) = 38;
+
+	/*
+	 * Estimated hit ratios at other cache sizes, from a slave; see
+	 * dsdc_mrcs_t.
+	 */
+	 dsdc_get_mrc_res_t
+	 DSDC_GET_MRC(dsdc_get_mrc_arg_t) = 39;
+
+	/*
+	 * Stats from many slaves, merged on the master; see
+	 * dsdc_stats_agg_t.
+	 */
+	 dsdc_get_stats_agg_res_t
+	 DSDC_GET_STATS_AGG(dsdc_get_stats_agg_arg_t) = 40;
+
+	/*
+	 * Traced GET4 and PUT6, and the spans a server's kept; see
+	 * dsdc_trace_t.
+	 */
+	 dsdc_get_res_t
+	 DSDC_GET5(dsdc_get5_arg_t) = 41;
+
+	 dsdc_res_t
+	 DSDC_PUT7(dsdc_put7_arg_t) = 42;
+
+	 dsdc_get_traces_res_t
+	 DSDC_GET_TRACES(dsdc_get_traces_arg_t) = 43;
+
+	/*
+	 * A slave's cache, by what's in it; see dsdc_profile_t.
+	 */
+	 dsdc_get_profile_res_t
+	 DSDC_GET_PROFILE(void) = 44;
+
+	/*
+	 * Event-loop lag and utilization, from any master, proxy, slave
+	 * or lock server; see dsdc_loop_stats_t.
+	 */
+	 dsdc_get_loop_stats_res_t
+	 DSDC_GET_LOOP_STATS(dsdc_get_loop_stats_arg_t) = 45;
+
+	/*
+	 * A compressed write; see dsdc_putz_arg_t.
+	 */
+	 dsdc_res_t
+	 DSDC_PUTZ(dsdc_putz_arg_t) = 46;
+
+	/*
+	 * Chunked objects' manifests; see dsdc_chunk_manifest_t.
+	 */
+	 dsdc_res_t
+	 DSDC_PUT_MANIFEST(dsdc_put6_arg_t) = 47;
+
+	 dsdc_get_res_t
+	 DSDC_GET_MANIFEST(dsdc_key_t) = 48;
+
+	/*
+	 * GETSTATE, with every lock server; masters that don't know it
+	 * reject it with PROC_UNAVAIL, and GETSTATE will do.  The key is
+	 * the hash of the dsdcx_state2_t the caller has.
+	 */
+	 dsdc_getstate2_res_t
+	 DSDC_GETSTATE2(dsdc_key_t) = 49;
+
+	/*
+	 * GET_STATS_SINGLE, with histogram2s; slaves that don't know it
+	 * reject it with PROC_UNAVAIL.
+	 */
+	 dsdc_get_stats_single2_res_t
+	 DSDC_GET_STATS_SINGLE2(dsdc_get_stats_single_arg_t) = 50;
+
 
 	} = 1;
 } = 30002;
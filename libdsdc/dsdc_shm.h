@@ -0,0 +1,208 @@
+// -*- mode: c++; tab-width: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//-----------------------------------------------------------------------
+
+#ifndef _DSDC_SHM_H_
+#define _DSDC_SHM_H_
+
+#include "async.h"
+#include "ihash.h"
+#include "list.h"
+#include "dsdc_prot.h"
+#include "dsdc_fast.h"
+
+//
+// The shared-memory transport.
+//
+//   For smart clients and a proxy on the same host.  A proxy started
+//   with -U <path> listens for RPC on the unix socket <path>, and for
+//   shared-memory connections on <path>.shm.  To connect, a client
+//   makes a segment holding two rings (requests one way, replies the
+//   other), connects to <path>.shm, and hands the proxy the segment's
+//   fd over the socket.  Segments are memfds, sealed so that neither
+//   side can change their size once they're mapped; that takes Linux
+//   3.17 or later, and elsewhere clients go over RPC instead.
+//
+//   From then on, requests and replies go through the rings in the
+//   fast-path framing (see dsdc_fast.h), and objects are copied
+//   straight into and out of the shared memory, never through the
+//   kernel.
+//
+//   The socket stays open as a doorbell, and to tell either side when
+//   the other goes away.  A side only rings (writes a byte) when the
+//   other has said it's idle, or is waiting for room in a ring, so a
+//   busy connection makes few system calls.
+//
+//   Segment layout:
+//
+//      dsdc_shm_hdr_t   64 bytes
+//      dsdc_shm_ctl_t   requests ring
+//      dsdc_shm_ctl_t   replies ring
+//      ring_sz bytes    requests
+//      ring_sz bytes    replies
+//
+
+#define DSDC_SHM_MAGIC 0xd5dc5301
+#define DSDC_SHM_HDRSZ 64
+
+struct dsdc_shm_hdr_t {
+    u_int32_t magic;
+    u_int32_t ring_sz; // a power of 2
+};
+
+// One ring's control block.  head and tail count bytes ever written
+// and read, so the ring's empty when they're equal; each lives on a
+// cache line of its own, since they're written from different sides.
+struct dsdc_shm_ctl_t {
+    u_int64_t head; // written by the producer only
+    char _pad1[56];
+    u_int64_t tail; // written by the consumer only
+    char _pad2[56];
+    u_int32_t idle; // consumer is waiting on the doorbell
+    u_int32_t full; // producer is waiting on the doorbell for room
+    char _pad3[56];
+};
+
+// size of a segment whose rings hold <ring_sz> bytes each
+size_t dsdc_shm_segsz(u_int32_t ring_sz);
+
+//
+// dsdc_shm_ring_t
+//
+//   One side's view of a ring; whoever holds it is either only ever
+//   pushing, or only ever reading.
+//
+class dsdc_shm_ring_t {
+  public:
+    dsdc_shm_ring_t() : _ctl(NULL), _data(NULL), _sz(0) {}
+    void init(dsdc_shm_ctl_t* c, char* d, u_int32_t sz);
+
+    // producer: copy in a record of <hlen> + <blen> bytes, all at once;
+    // false, leaving the ring alone, if there's no room for it.
+    // *ring is set if the consumer needs to be woken up.
+    bool push(
+        const char* h, size_t hlen, const char* b, size_t blen, bool* ring);
+
+    // producer, after push() failed: ask to be rung once there's room;
+    // false if there's room already.
+    bool wait_for_room(size_t n);
+
+    // consumer: bytes waiting to be read, and reading them
+    size_t resid() const;
+    void copyout(size_t off, char* out, size_t n) const;
+
+    // consumer: done with the first <n> bytes; true if the producer
+    // needs to be woken up
+    bool consume(size_t n);
+
+    // consumer: about to wait on the doorbell; false if more came in
+    // before we could say so
+    bool go_idle();
+
+    u_int32_t
+    size() const {
+        return _sz;
+    }
+
+  private:
+    dsdc_shm_ctl_t* _ctl;
+    char* _data;
+    u_int32_t _sz;
+};
+
+//
+// dsdc_shm_conn_t
+//
+//   What both ends of a connection have in common: the mapping, the
+//   doorbell, and records that didn't fit in the outgoing ring yet.
+//
+class dsdc_shm_conn_t : public virtual refcount {
+  public:
+    virtual ~dsdc_shm_conn_t();
+
+    bool
+    is_dead() const {
+        return _fd < 0;
+    }
+
+  protected:
+    dsdc_shm_conn_t(const str& id) : _id(id), _fd(-1), _base(NULL), _len(0) {}
+
+    // map the <len>-byte segment at <mfd> (which is then closed);
+    // <client> says which ring is ours to write
+    bool map(int mfd, size_t len, bool client);
+
+    // start watching the doorbell
+    void start(int fd);
+
+    // send a record, or queue it up until there's room for it
+    void post(const char* h, size_t hlen, const char* b, size_t blen);
+
+    // done with the first <n> bytes of _in
+    void consumed(size_t n);
+
+    // handle records in _in until it's empty, or we're dead
+    virtual void drain() = 0;
+    virtual void shutdown(const str& why);
+
+    const str _id;
+    int _fd;
+    dsdc_shm_ring_t _in, _out;
+
+  private:
+    void readable();
+    void service();
+    void flush();
+    void ring();
+
+    void* _base;
+    size_t _len;
+    vec<str> _backlog;
+};
+
+//-----------------------------------------------------------------------
+
+//
+// dsdci_shm_conn_t
+//
+//   The client end of a shared-memory connection to a proxy, which
+//   does for the proxy what dsdci_fast_conn_t does for slaves, and
+//   handles requests the same way (see dsdci_fast_reqs_t).
+//
+class dsdci_shm_conn_t : public dsdc_shm_conn_t, public dsdci_fast_reqs_t {
+  public:
+    // connect to the proxy listening at <path>.shm; NULL on failure
+    static ptr<dsdci_shm_conn_t> alloc(const str& path, u_int timeout);
+    ~dsdci_shm_conn_t();
+
+    // if an object of <n> bytes can go over this connection at all
+    bool
+    fits(size_t n) const {
+        return DSDC_FAST_REQ_HDRSZ + n <= _out.size() &&
+               DSDC_FAST_RES_HDRSZ + n <= _in.size();
+    }
+
+  protected:
+    dsdci_shm_conn_t(const str& id, u_int timeout);
+    bool write_req(const char* h, size_t hlen, const char* b, size_t blen);
+
+  private:
+    void drain();
+    void shutdown(const str& why);
+};
+
+//-----------------------------------------------------------------------
+
+// listen on the unix socket at <path>, clearing out any stale one
+// left behind; -1 on failure, or if something's listening there still
+int dsdc_unix_listen(const str& path);
+
+// accept a connection on unix socket <lfd>; -1 on failure
+int dsdc_unix_accept(int lfd);
+
+// receive a client's segment over a new connection on <fd>; the fd of
+// the segment, and its size in *len, or -1 if it didn't send a sane
+// one.  Segments have to be sealed against resizing, so that a
+// client can't shrink one out from under the proxy's mapping.
+int dsdc_shm_accept(int fd, size_t* len);
+
+#endif /* _DSDC_SHM_H_ */
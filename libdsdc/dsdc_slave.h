@@ -18,11 +18,16 @@
 #include "qhash.h"
 #include "dsdc_stats.h"
 #include "litetime.h"
+#include "dsdc_fast.h"
+#include "dsdc_mrc.h"
+#include "dsdc_compress.h"
+#include "dsdc_metrics.h"
 
 struct dsdc_cache_obj_t {
     dsdc_cache_obj_t()
         : _timein(sfs_get_timenow()), _annotation(NULL), _n_gets(0),
-          _n_gets_in_epoch(0) {}
+          _n_gets_in_epoch(0), _codec(DSDC_CODEC_NONE), _raw_sz(0),
+          _version(0), _manifest(false) {}
     void
     reset() {
         _timein = sfs_get_timenow();
@@ -30,7 +35,9 @@ struct dsdc_cache_obj_t {
     void
     set(const dsdc_key_t& k,
         const dsdc_obj_t& o,
-        dsdc::annotation::base_t* a = NULL);
+        dsdc::annotation::base_t* a = NULL,
+        dsdc_codec_t codec = DSDC_CODEC_NONE,
+        size_t raw_sz = 0);
     dsdc_cache_obj_t(const dsdc_key_t& k, const dsdc_obj_t& o);
     time_t
     lifetime() const {
@@ -49,19 +56,36 @@ struct dsdc_cache_obj_t {
     annotation() {
         return _annotation;
     }
+    // what the object takes up in memory; for compressed objects,
+    // that's the compressed size
     size_t
     size() const {
         return _key.size() + _obj.size() + sizeof(*this);
     }
+    // as above, were the object uncompressed
+    size_t
+    raw_size() const {
+        return _key.size() + _raw_sz + sizeof(*this);
+    }
+    bool
+    compressed() const {
+        return _codec != DSDC_CODEC_NONE;
+    }
     void
     collect_statistics(bool del = true, dsdc::action_code_t t = dsdc::AC_NONE);
     bool match_checksum(const dsdc_cksum_t& cksum) const;
+    // the object as the client wrote it, uncompressed
+    bool raw(dsdc_obj_t* out) const;
 
     dsdc_key_t _key;
     dsdc_obj_t _obj;
     time_t _timein;
     dsdc::annotation::base_t* _annotation;
     u_int _n_gets, _n_gets_in_epoch;
+    dsdc_codec_t _codec; // as written with PUTZ
+    size_t _raw_sz;
+    u_int64_t _version; // see dsdc_atomic_arg_t
+    bool _manifest;     // as written with PUT_MANIFEST
 
     ihash_entry<dsdc_cache_obj_t> _hlnk;
     tailq_entry<dsdc_cache_obj_t> _qlnk;
@@ -93,6 +117,14 @@ class dsdcs_master_t {
     status() const {
         return _status;
     }
+    const str&
+    hostname() const {
+        return _hostname;
+    }
+    int
+    port() const {
+        return _port;
+    }
 
     list_entry<dsdcs_master_t> _lnk;
 
@@ -146,6 +178,30 @@ class dsdcs_p2p_cli_t {
     const str _hn;
 };
 
+class dsdc_slave_t;
+
+// service fast-path requests; see dsdc_fast.h
+class dsdcs_fast_cli_t {
+  public:
+    dsdcs_fast_cli_t(dsdc_slave_t* p, int f, const str& h);
+    ~dsdcs_fast_cli_t();
+
+  private:
+    void readable();
+    void writable();
+    bool parse();
+    void handle(const dsdc_fast_req_hdr_t& h, const dsdc_obj_t* o);
+    void reply(u_int32_t id, dsdc_res_t r, const dsdc_obj_t* o = NULL);
+    void shutdown(const str& why);
+
+    dsdc_slave_t* const _parent;
+    const int _fd;
+    const str _hn;
+    suio _in, _out;
+    bool _write_wait;
+    bool _reading; // false while _out is over dsdcs_fast_max_out
+};
+
 #define SLAVE_DETERMINISTIC_SEEDS (1 << 0)
 #define SLAVE_NO_CLEAN (1 << 1)
 
@@ -168,6 +224,10 @@ class dsdc_slave_app_t : public dsdc_app_t {
         return false;
     }
 
+    // a master says another slave has taken our place
+    virtual void
+    replaced() {}
+
     str startup_msg() const;
     virtual void
     startup_msg_v(strbuf* b) const {}
@@ -175,7 +235,19 @@ class dsdc_slave_app_t : public dsdc_app_t {
 
   protected:
     bool get_port();
+    void connect_masters();
+    // if init() should leave connecting to the masters for later
+    virtual bool
+    defer_masters() const {
+        return false;
+    }
     void new_connection();
+    bool get_unix_port();
+    void new_unix_connection();
+
+    // make <n> keys for our nodes on the ring, unique to this process
+    // unless the seeds are deterministic
+    void make_keys(u_int n, dsdc_keyset_t* out) const;
     /**
      * return an aclnt for the master that's currently serving as the
      * master primary.
@@ -187,18 +259,68 @@ class dsdc_slave_app_t : public dsdc_app_t {
     bool _primary; // a flag that's used to add the primary master only once
     int _port;     // listen for p2p communication
     int _lfd;
+    int _unix_lfd; // ...and on dsdc_unix_path, if given
 
     int _opts;        // options for configuring this slave
     bool _stats_mode; // on if we should be collecting stats
     int _stats_mode2; // > 0 if stats2 is running currently
 };
 
+// Lock servers put nodes on the lock ring (see dsdc_lockring.h), and
+// serve the locks whose keys fall to them.
+//
+// A lock server can have a standby.  The primary (given the standby's
+// address) sends it a snapshot of all its locks, then every grant,
+// release and renewal, and only answers a client once the standby has
+// what it's answering; when idle, it pings the standby every
+// dsdcl_repl_ping_ms.  The standby stays away from the masters.  Once
+// it hasn't heard from the primary for a heartbeat interval, it asks
+// them whether they still have the primary, and only if they don't
+// does it take over: it registers with the primary's keys, so it gets
+// the primary's share of the lock ring, and the masters drop the old
+// primary.  Leases carry over with whatever time they had left.
+//
+// If the standby can't be reached, the primary holds its answers,
+// since they'd be for grants the standby never saw, and tries again
+// every second.  Once it's back, they go out after the snapshot.  If
+// it's still gone after dsdcl_repl_hold_s, and the masters still have
+// us (so the standby won't take over), the primary goes on alone.
+//
+// A lock server asks the masters for the lock ring every
+// dsdcs_getstate_interval, and only grants the locks that are its own
+// to grant under it (see dsdcl_handoff_t): it turns away the rest with
+// DSDC_NONODE, and makes those lately come over from another lock
+// server wait, blocking acquires until they're free to grant, and
+// the rest with DSDC_LOCKED.  When a lock moves away, its waiters are
+// told they won't get it, and its holders can't renew.
 class dsdcs_lockserver_t : public dsdc_slave_app_t, public dsdcl_mgr_t {
   public:
-    dsdcs_lockserver_t(int port, int o = 0) : dsdc_slave_app_t(port, o) {}
+    dsdcs_lockserver_t(int port, int o = 0, u_int nnodes = 0)
+        : dsdc_slave_app_t(port, o),
+          _n_nodes(nnodes ? nnodes : dsdcl_nnodes), _standby_port(0),
+          _repl_up(false), _repl_lost(0), _repl_tcb(NULL), _standby(false),
+          _synced(false), _last_repl(0) {
+        memset(_ring_hash.base(), 0, _ring_hash.size());
+    }
     virtual ~dsdcs_lockserver_t() {}
+    bool init();
+
+    // primary: replicate to the standby at <h>:<p>
+    void
+    set_standby_target(const str& h, int p) {
+        _standby_host = h;
+        _standby_port = p;
+    }
+    // wait as a standby for a primary to replicate to us
+    void
+    set_warm_standby() {
+        _standby = true;
+    }
+    void replaced();
+
     void dispatch(svccb* sbp);
     void get_xdr_repr(dsdcx_slave_t* x);
+    void startup_msg_v(strbuf* b) const;
     bool
     is_lock_server() const {
         return true;
@@ -207,16 +329,70 @@ class dsdcs_lockserver_t : public dsdc_slave_app_t, public dsdcl_mgr_t {
     progname_xtra() const {
         return "_nlm";
     }
+
+  protected:
+    bool
+    defer_masters() const {
+        return _standby || _standby_host;
+    }
+    void replicate(
+        dsdc_lock_repl_op_type_t t,
+        const dsdc_key_t& k,
+        const dsdcl_holder_t* h);
+    void sync(cbv cb);
+
+  private:
+    void admit(svccb* sbp);
+    void renew_if_ours(svccb* sbp);
+    bool owns(const dsdc_key_t& k);
+    void ring_loop(CLOSURE);
+    void new_ring(const dsdcx_state2_t& s);
+
+    void handle_replicate(svccb* sbp);
+    void repl_loop(CLOSURE);
+    void repl_poke();
+    void repl_timeout();
+    void watchdog(CLOSURE);
+    void primary_gone(evb_t ev, CLOSURE);
+    void promote();
+
+    dsdc_keyset_t _keys;
+    const u_int _n_nodes;
+
+    dsdcl_handoff_t _handoff;
+    dsdc_key_t _ring_hash; // of the state _handoff has
+
+    // primary
+    str _standby_host;
+    int _standby_port;
+    bool _repl_up;                    // standby has all but _repl_q
+    time_t _repl_lost;                // when we lost it, if holding
+    vec<dsdc_lock_repl_op_t> _repl_q; // not sent yet
+    vec<cbv> _repl_syncs;             // waiting on the next batch
+    evv_t::ptr _repl_wake;
+    timecb_t* _repl_tcb;
+
+    // standby
+    bool _standby;
+    bool _synced;      // we've had a primary's snapshot
+    time_t _last_repl; // when we last heard from it
+    dsdc_keyset_t _primary_keys;
 };
 
 class dsdc_lru_t {
   public:
-    dsdc_lru_t() : _slow_cursor(NULL) {}
+    // the slow walks that can be going at once
+    enum { SLOW_CLEAN = 0, SLOW_PROFILE = 1, N_SLOW = 2 };
+
+    dsdc_lru_t() {
+        for (int i = 0; i < N_SLOW; i++)
+            _slow_cursor[i] = NULL;
+    }
 
     // For a "slow walk" over the LRU, which can be interrupted by
     // twaits{}'s, use this slow_next() feature.
-    void slow_reset();
-    dsdc_cache_obj_t* slow_next();
+    void slow_reset(int w = SLOW_CLEAN);
+    dsdc_cache_obj_t* slow_next(int w = SLOW_CLEAN);
 
     dsdc_cache_obj_t* first();
     dsdc_cache_obj_t* next(dsdc_cache_obj_t* o);
@@ -225,10 +401,202 @@ class dsdc_lru_t {
     void insert_tail(dsdc_cache_obj_t* o);
 
   private:
-    dsdc_cache_obj_t* _slow_cursor;
+    dsdc_cache_obj_t* _slow_cursor[N_SLOW];
     tailq<dsdc_cache_obj_t, &dsdc_cache_obj_t::_qlnk> _lru;
 };
 
+// What's in the cache, added up an object at a time as the slave
+// walks it for DSDC_GET_PROFILE: by annotation, by size and by age
+// (see dsdc_profile_t).  Annotations are found by pointer, since
+// there's one of each.
+class dsdcs_profile_t {
+  public:
+    dsdcs_profile_t();
+    ~dsdcs_profile_t() {
+        reset();
+    }
+
+    void add(const dsdc_cache_obj_t* o);
+    void output(dsdc_profile_t* out) const;
+    void reset();
+
+  private:
+    typedef const dsdc::annotation::base_t* an_t;
+
+    struct annotated_t {
+        annotated_t(an_t a) : an(a) {
+            bin.n_objs = bin.bytes = bin.raw_bytes = 0;
+        }
+        an_t an;
+        dsdc_profile_bin_t bin;
+        ihash_entry<annotated_t> _hlnk;
+    };
+
+    struct an_hashfn_t {
+        hash_t
+        operator()(an_t a) const {
+            return hash_t(uintptr_t(a) >> 3);
+        }
+    };
+
+    dsdc_profile_bin_t _all;
+    vec<dsdc_profile_bin_t> _by_size, _by_age;
+    ihash<an_t,
+          annotated_t,
+          &annotated_t::an,
+          &annotated_t::_hlnk,
+          an_hashfn_t>
+        _annotated;
+};
+
+// Lookups, for Prometheus, by annotation and result (hit, miss or
+// expired).  They're counted on every GET, so they're found by
+// annotation pointer and only labelled for a scrape.  Annotations go
+// when the stats collector is replaced, so flush() labels what's been
+// counted before then.  Past dsdc_metrics_max_series annotations, the
+// rest count as annotation="other".
+class dsdcs_gets_metric_t : public dsdc::metrics::metric_t {
+  public:
+    dsdcs_gets_metric_t();
+    ~dsdcs_gets_metric_t();
+
+    void inc(const dsdc::annotation::base_t* a, dsdc::action_code_t t);
+    void flush();
+    void render(strbuf& b) const;
+
+  private:
+    typedef const dsdc::annotation::base_t* an_t;
+    enum { HIT = 0, MISS = 1, EXPIRED = 2, N_RESULTS = 3 };
+
+    struct series_t {
+        series_t(an_t a) : an(a) {
+            memset(n, 0, sizeof(n));
+        }
+        an_t an;
+        u_int64_t n[N_RESULTS];
+        ihash_entry<series_t> _hlnk;
+    };
+
+    struct an_hashfn_t {
+        hash_t
+        operator()(an_t a) const {
+            return hash_t(uintptr_t(a) >> 3);
+        }
+    };
+
+    // counts by their labels, as flushed or for a scrape
+    struct totals_t {
+        void add(const str& an, int r, u_int64_t v);
+        void add(const totals_t& t);
+        qhash<str, size_t> index;
+        vec<str> labels;
+        vec<u_int64_t> n;
+    };
+
+    void add_to(totals_t* t) const;
+
+    ihash<an_t, series_t, &series_t::an, &series_t::_hlnk, an_hashfn_t>
+        _series;
+    u_int64_t _other[N_RESULTS];
+    totals_t _flushed;
+};
+
+// The newest fencing token seen for each key that's been written with
+// one (see DSDC_PUT6).  It's kept apart from the cache, so that a key's
+// token outlives the object being evicted or removed.  A key is
+// forgotten once it's gone dsdcs_fence_horizon_s without a fenced
+// write, and its token becomes a floor that fenced writes to keys we
+// don't know are held to, so forgetting can only ever turn away more
+// writes than it should, never let a stale one through.  Tokens are
+// the lock server's clock, so the floor trails it by the horizon, and
+// only a lock held longer than that can find itself under it.  Past
+// dsdcs_fence_table_sz keys, the oldest are forgotten early anyway,
+// which does raise the floor to something recent; that's a backstop
+// for memory, and warns.
+//
+// Only fenced writes are checked.  PUT through PUT5, MPUT, the fast
+// path, REMOVE and ATOMIC don't carry a token and go straight through.
+class dsdcs_fences_t {
+  public:
+    dsdcs_fences_t() : _floor(0), _warned(false) {}
+    ~dsdcs_fences_t();
+
+    // false if <tok> is older than what's been seen for <k>; otherwise
+    // it's now the newest
+    bool check(const dsdc_key_t& k, u_int64_t tok);
+
+  private:
+    struct fence_t {
+        fence_t(const dsdc_key_t& k, u_int64_t t)
+            : key(k), tok(t), written(sfs_get_timenow()) {}
+        dsdc_key_t key;
+        u_int64_t tok;
+        time_t written;
+        ihash_entry<fence_t> _hlnk;
+        tailq_entry<fence_t> _qlnk;
+    };
+
+    void forget(fence_t* f);
+
+    u_int64_t _floor;
+    bool _warned;
+    ihash<dsdc_key_t,
+          fence_t,
+          &fence_t::key,
+          &fence_t::_hlnk,
+          dsdck_hashfn_t,
+          dsdck_equals_t>
+        _fences;
+    tailq<fence_t, &fence_t::_qlnk> _lru;
+};
+
+// The keys getting the most traffic, by space-saving: there are
+// dsdcs_hotkeys_sz counters, and a key without one takes over the
+// smallest, with that count as its possible overcount.  Any key with
+// more than 1/dsdcs_hotkeys_sz of the traffic is sure to have a
+// counter.  Every dsdcs_hotkeys_decay_s seconds the counts are all
+// halved, so they follow recent traffic; the window they stand for
+// is kept alongside, to turn them into rates.  A hit is a hash lookup
+// and a heap sift.
+class dsdcs_hotkeys_t {
+  public:
+    dsdcs_hotkeys_t();
+    ~dsdcs_hotkeys_t() {
+        reset();
+    }
+
+    void hit(const dsdc_key_t& k);
+    // the <n> hottest, hottest first
+    void top(size_t n, dsdc_hotkeys_t* out) const;
+    void reset();
+
+  private:
+    struct counter_t {
+        counter_t(const dsdc_key_t& k) : key(k), count(0), err(0), pos(0) {}
+        dsdc_key_t key;
+        u_int64_t count;
+        u_int64_t err; // at most this much of <count> is someone else's
+        size_t pos;    // in _heap
+        ihash_entry<counter_t> _hlnk;
+    };
+
+    void decay();
+    void place(size_t i, counter_t* c);
+    void sift_up(size_t i);
+    void sift_down(size_t i);
+
+    vec<counter_t*> _heap; // by count, smallest first
+    ihash<dsdc_key_t,
+          counter_t,
+          &counter_t::key,
+          &counter_t::_hlnk,
+          dsdck_hashfn_t,
+          dsdck_equals_t>
+        _counters;
+    time_t _last_decay;
+    u_int64_t _window_ms; // as of _last_decay
+};
+
 class dsdc_slave_t : public dsdc_slave_app_t, public dsdc_system_state_cache_t {
   public:
     dsdc_slave_t(
@@ -256,13 +624,24 @@ class dsdc_slave_t : public dsdc_slave_app_t, public dsdc_system_state_cache_t {
 
     void dispatch(svccb* sbp);
     void handle_get(svccb* sbp);
+    void handle_get_manifest(svccb* sbp);
     void handle_mget(svccb* sbp);
     void handle_put(svccb* sbp);
     void handle_put3(svccb* sbp);
     void handle_put4(svccb* sbp);
+    void handle_put5(svccb* sbp);
+    void handle_put6(svccb* sbp);
+    void handle_mput(svccb* sbp);
+    void handle_mremove(svccb* sbp);
     void handle_remove(svccb* sbp);
     void handle_get_stats(svccb* sbp);
     void handle_set_stats_mode(svccb* sbp);
+    void handle_fast_port(svccb* sbp);
+    void handle_compression(svccb* sbp);
+    void handle_atomic(svccb* sbp);
+    void handle_get_hotkeys(svccb* sbp);
+    void handle_get_mrc(svccb* sbp);
+    void handle_get_profile(svccb* sbp);
 
     // Match function addition.
     void handle_compute_matches(svccb* sbp);
@@ -289,35 +668,66 @@ class dsdc_slave_t : public dsdc_slave_app_t, public dsdc_system_state_cache_t {
     void set_stats_mode2(int i);
 
   protected:
+    friend class dsdcs_fast_cli_t;
+
     void run_stats2_loop(CLOSURE);
+    bool get_fast_port();
+    void new_fast_connection();
 
     dsdc_res_t handle_put(
         const dsdc_key_t& k,
         const dsdc_obj_t& o,
         dsdc::annotation::base_t* a = NULL,
-        const dsdc_cksum_t* cksum = NULL);
+        const dsdc_cksum_t* cksum = NULL,
+        dsdc_codec_t codec = DSDC_CODEC_NONE,
+        size_t raw_sz = 0);
+    dsdc_res_t
+    handle_remove(const dsdc_key_t& k, const dsdc_annotation_t* a = NULL);
     void genkeys();
-
+    bool dead_on_arrival(svccb* sbp, const dsdc_deadline_t* d);
+    dsdc_res_t handle_atomic(
+        const dsdc_key_t& k, const dsdc_atomic_op_t& op, dsdc_atomic_res_t* r);
+    u_int64_t next_version();
+
+    // the object as it was written, uncompressed if need be; that's
+    // good until the next lookup.  If there's none, <miss> says why:
+    // DSDC_NOTFOUND, DSDC_EXPIRED, or DSDC_CHUNKED for manifests.
     dsdc_obj_t* lru_lookup(
         const dsdc_key_t& k,
         const int expire = -1,
         dsdc::annotation::base_t* a = NULL,
-        bool* expired = NULL);
+        dsdc_res_t* miss = NULL);
+    dsdc_obj_t _unz; // lru_lookup()'s, for compressed objects
 
     size_t lru_remove_obj(dsdc_cache_obj_t* o, bool del, dsdc::action_code_t t);
+
+    // chunks of manifests that have gone, to be removed by way of the
+    // primary master, since slaves don't talk to each other
+    void drop_chunks(const dsdc_obj_t& manifest);
+    vec<dsdc_key_t> _dead_chunks;
+    bool _dropping_chunks;
     bool lru_remove(const dsdc_key_t& k);
     dsdc_res_t lru_insert(
         const dsdc_key_t& k,
         const dsdc_obj_t& o,
         dsdc::annotation::base_t* a = NULL,
-        const dsdc_cksum_t* cks = NULL);
+        const dsdc_cksum_t* cks = NULL,
+        const u_int64_t* version = NULL,
+        dsdc_codec_t codec = DSDC_CODEC_NONE,
+        size_t raw_sz = 0);
     size_t _lrusz;
+    size_t _lrusz_raw;     // _lrusz if everything were uncompressed
+    size_t _n_compressed;  // objects in the LRU that are compressed
+    u_int64_t _last_version;
 
     void
     clean_cache() {
         clean_cache_T();
     }
 
+    int _fast_port; // 0 if not serving the fast path
+    int _fast_lfd;
+
     dsdc_keyset_t _keys;
     const u_int _n_nodes;
     const size_t _maxsz;
@@ -335,9 +745,15 @@ class dsdc_slave_t : public dsdc_slave_app_t, public dsdc_system_state_cache_t {
     bhash<dsdc_key_t, dsdck_hashfn_t, dsdck_equals_t> _khash;
 
     dsdc_lru_t _lru;
+    dsdcs_fences_t _fences;
+    dsdcs_hotkeys_t _hot_reads, _hot_writes;
+    dsdcs_mrc_t _mrc;
+    vec<svccb*> _profile_waiters; // for the walk going, if there is one
 
   private:
     void clean_cache_T(CLOSURE);
+    void profile_T(CLOSURE);
+    void drop_chunks_T(CLOSURE);
 };
 
 #endif /* _DSDC_SLAVE_H */
@@ -6,6 +6,7 @@
 
 #include "dsdc_prot.h"
 #include "dsdc_ring.h"
+#include "dsdc_lockring.h"
 #include "arpc.h"
 #include "tame.h"
 
@@ -33,21 +34,31 @@ class dsdc_system_state_cache_t {
     post_construct() {}
     virtual bool clean_on_all_masters_dead() const = 0;
 
-    void handle_refresh(const dsdc_getstate_res_t& r);
+    void handle_refresh(const dsdc_getstate2_res_t& r);
     void refresh(evv_t::ptr ev = NULL, CLOSURE);
     void refresh_loop(bool try_first, CLOSURE);
 
     void refresh_lock_server();
+    void refresh_lock_ring();
     void change_lock_server_to(aclnt_wrap_t* nl);
+
+    // where the lock for <k> lives; NULL if there's no lock server
+    aclnt_wrap_t*
+    lock_server_for(const dsdc_key_t& k) {
+        return dsdcl_lock_server_for(_lock_ring, _lock_server, k);
+    }
+
     str fingerprint(str* in) const;
     void clear_all();
 
-    dsdcx_state_t _system_state;
-    dsdc_key_t _system_state_hash;
+    dsdcx_state2_t _system_state;
+    dsdc_key_t _system_state_hash;  // of _system_state.state, for GETSTATE
+    dsdc_key_t _system_state2_hash; // of all of it, for GETSTATE2
     u_int _n_updates_since_clean;
     dsdc_hash_ring_t _hash_ring;
     ptr<bool> _destroyed;
     aclnt_wrap_t* _lock_server;
+    dsdc_hash_ring_t _lock_ring; // empty if no lock server has nodes
     bool _loop_running;
 };
 
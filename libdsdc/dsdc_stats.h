@@ -68,6 +68,10 @@ namespace annotation {
         output(dsdc_statistic_t* out, const dsdc_dataset_params_t& p) {
             return false;
         }
+        virtual bool
+        output2(dsdc_statistic2_t* out, const dsdc_dataset_params_t& p) {
+            return false;
+        }
 
         list_entry<base_t> _llnk;
     };
@@ -85,6 +89,12 @@ namespace stats {
         virtual dsdc_res_t
         output(dsdc_statistics_t* sz, const dsdc_dataset_params_t& p) = 0;
 
+        // with sketches; only the v1 stats have them
+        virtual dsdc_res_t
+        output2(dsdc_statistics2_t* sz, const dsdc_dataset_params_t& p) {
+            return DSDC_BAD_STATS;
+        }
+
         virtual obj_t*
         alloc(const dsdc_annotation_t& a, bool newobj = true) = 0;
 
@@ -136,6 +146,32 @@ namespace stats {
 
     collector_base_t* collector();
     void set_collector(collector_base_t* b);
+
+    //------------------------------------------------------------
+
+    // A factory's int annotations, by value, for values from 0 to
+    // dsdc_stats_dense_ids: once one's been seen, finding it again is
+    // an array load rather than a hash probe.  The factory's table
+    // still owns them.
+    template <class T> class id_index_t {
+      public:
+        T*
+        lookup(dsdc_id_t i) const {
+            return (i >= 0 && size_t(i) < _v.size()) ? _v[i] : NULL;
+        }
+
+        void
+        remember(dsdc_id_t i, T* t) {
+            if (i < 0 || size_t(i) >= dsdc_stats_dense_ids)
+                return;
+            while (_v.size() <= size_t(i))
+                _v.push_back(NULL);
+            _v[i] = t;
+        }
+
+      private:
+        vec<T*> _v;
+    };
 };
 
 //
@@ -20,20 +20,57 @@ namespace stats {
 
     //-----------------------------------------------------------------------
 
+    //
+    // A log-linear histogram, like HdrHistogram's: values under
+    // 2^SUB_BITS get a bucket each, and above that, each power of two
+    // is split into 2^(SUB_BITS - 1) buckets, so a value's bucket is
+    // within about 3% of it.  Adds are O(1), and the buckets only go
+    // as far as the largest value seen, so memory's bounded (by
+    // NBUCKETS counters) however many samples there are.  Histograms
+    // with the same scale factor can be merged, here or off the wire.
+    //
     struct histogram_t {
-
-        histogram_t(int sf = 100)
-            : _scale_factor(sf), _min(INT_MAX), _max(INT_MIN) {}
+        enum {
+            SUB_BITS = 6,
+            MAX_BITS = 40, // values past 2^40 count as 2^40 - 1
+            NBUCKETS = (1 << SUB_BITS) + (MAX_BITS - SUB_BITS) *
+                                             (1 << (SUB_BITS - 1))
+        };
+
+        histogram_t(int sf = 100) : _scale_factor(sf) {
+            reset();
+        }
         void add(int e);
         void reset();
+        void merge(const histogram_t& h);
+        // false if <h> has a different scale factor or bucketing
+        bool merge(const dsdc_histogram2_t& h);
+        bool mergeable(const dsdc_histogram2_t& h) const;
         void to_xdr(dsdc_histogram_t* out, size_t nbuc);
+        void to_xdr(dsdc_histogram2_t* out, size_t nbuc);
+        // the <q>th quantile (0 < q <= 1), times the scale factor
+        int64_t quantile(double q) const;
         int
         scale_factor() const {
             return _scale_factor;
         }
+        u_int64_t
+        samples() const {
+            return _n;
+        }
+
+        static size_t bucket_of(int64_t v);
+        static int64_t bucket_low(size_t i);
+        static int64_t bucket_mid(size_t i);
+
         int _scale_factor;
-        vec<int> _data_points;
-        int _min, _max;
+        vec<u_int64_t> _counts; // by bucket, up to the largest seen
+        u_int64_t _n;
+        int64_t _total;
+        int64_t _min, _max;
+
+      private:
+        void count(size_t i, u_int64_t n);
     };
 
     //-----------------------------------------------------------------------
@@ -74,6 +111,16 @@ namespace stats {
         int* _n_active;
 
         bool output(dsdc_dataset_t* out, const dsdc_dataset_params_t& p);
+        bool output(dsdc_dataset2_t* out, const dsdc_dataset_params_t& p);
+
+        // add in what <e> counted, but for the gets and lifetimes,
+        // which each dataset samples for itself
+        void absorb(const dataset_t& e);
+
+        // add in <d>, another server's, as far as it goes; check it's
+        // mergeable() first
+        bool mergeable(const dsdc_dataset2_t& d) const;
+        void merge(const dsdc_dataset2_t& d);
 
         time_t _start_time;
 
@@ -89,6 +136,10 @@ namespace annotation {
 
     //-----------------------------------------------------------------------
 
+    // Events are counted in the epoch's dataset only, and added into
+    // the all-time one when they're output, so each costs one update
+    // rather than two.  Gets and lifetimes are sampled by a sweep of
+    // the cache, for each dataset, as before.
     class base1_t : public base_t {
       public:
         base1_t() : base_t(), _alltime(false), _per_epoch(true) {}
@@ -99,10 +150,10 @@ namespace annotation {
         mark_get_attempt(action_code_t t) {}
 
         bool output(dsdc_statistic_t* out, const dsdc_dataset_params_t& p);
+        bool output2(dsdc_statistic2_t* out, const dsdc_dataset_params_t& p);
 
         void
         elem_create(size_t n) {
-            _alltime._creations++;
             _per_epoch._creations++;
             objsz(n);
         }
@@ -116,17 +167,14 @@ namespace annotation {
         void n_gets(int g, int gie);
         void
         missed_get() {
-            _alltime._missed_gets++;
             _per_epoch._missed_gets++;
         }
         void
         missed_remove() {
-            _alltime._missed_removes++;
             _per_epoch._missed_removes++;
         }
         void
         put() {
-            _alltime._puts++;
             _per_epoch._puts++;
         }
 
@@ -138,7 +186,6 @@ namespace annotation {
 
         void
         dead_object_n_gets(int n) {
-            _alltime._do_gets.add(n);
             _per_epoch._do_gets.add(n);
         }
         void
@@ -147,17 +194,14 @@ namespace annotation {
         }
         void
         dead_object_time_alive(int n) {
-            _alltime._do_lifetime.add(n);
             _per_epoch._do_lifetime.add(n);
         }
         void
         objsz(int n) {
-            _alltime._objsz.add(n);
             _per_epoch._objsz.add(n);
         }
         void
         dead_object_objsz(int n) {
-            _alltime._do_objsz.add(n);
             _per_epoch._do_objsz.add(n);
         }
 
@@ -166,6 +210,9 @@ namespace annotation {
         void dead_object(action_code_t t);
 
       private:
+        template<class S> bool
+        output_stat(S* out, const dsdc_dataset_params_t& p);
+
         stats::dataset_t _alltime, _per_epoch;
     };
 
@@ -226,6 +273,7 @@ namespace stats {
 
         typ* alloc(dsdc_id_t i, collector_base_t* c, bool newobj = true);
         ihash<dsdc_id_t, typ, &typ::_val, &typ::_hlnk> _tab;
+        id_index_t<typ> _dense;
     };
 
 #ifndef DSDC_NO_CUPID
@@ -236,6 +284,7 @@ namespace stats {
         typ* alloc(ok_frobber_t i, collector_base_t* c, bool newobj = true);
 
         ihash<int, typ, &typ::_val, &typ::_hlnk> _tab;
+        id_index_t<typ> _dense;
     };
 #endif /* DSDC_NO_CUPID */
 
@@ -257,6 +306,8 @@ namespace stats {
 
         dsdc_res_t
         output(dsdc_statistics_t* sz, const dsdc_dataset_params_t& p);
+        dsdc_res_t
+        output2(dsdc_statistics2_t* sz, const dsdc_dataset_params_t& p);
         u_int _n_stats;
 #ifndef DSDC_NO_CUPID
         annotation::frobber_t* frobber_alloc(ok_frobber_t f);
@@ -265,6 +316,50 @@ namespace stats {
     };
 
     //-----------------------------------------------------------------------
+
+    //
+    // Stats from several slaves, merged by annotation: their counters
+    // added and their histograms merged, as the master does for
+    // DSDC_GET_STATS_AGG.
+    //
+    class merger_t {
+      public:
+        ~merger_t();
+
+        // false if any of <in>'s histograms can't be merged (a slave
+        // with other scale factors or bucketing), and then none are;
+        // <host> is what outliers() calls it
+        bool add(const str& host, const dsdc_statistics2_t& in);
+        void output(dsdc_statistics2_t* out, const dsdc_dataset_params_t& p);
+
+        // up to <n> of the slaves added whose per-epoch puts, creations,
+        // missed gets or evictions, summed over annotations, are
+        // furthest by ratio from the median, furthest first
+        void outliers(u_int n,
+                      rpc_vec<dsdc_stats_outlier_t, RPC_INFINITY>* out) const;
+
+      private:
+        enum { N_TOTALS = 4 };
+        struct totals_t {
+            str host;
+            int64_t v[N_TOTALS];
+        };
+        vec<totals_t> _totals;
+
+        struct entry_t {
+            entry_t(const str& k, const dsdc_annotation_t& a)
+                : key(k), annotation(a), epoch(true), alltime(false) {}
+            str key;
+            dsdc_annotation_t annotation;
+            dataset_t epoch, alltime;
+            ihash_entry<entry_t> _hlnk;
+        };
+        entry_t* get(const dsdc_annotation_t& a);
+
+        ihash<str, entry_t, &entry_t::key, &entry_t::_hlnk> _tab;
+    };
+
+    //-----------------------------------------------------------------------
 };
 };
 
@@ -131,6 +131,7 @@ namespace stats {
 
       private:
         ihash<dsdc_id_t, typ, &typ::_val, &typ::_hlnk> _tab;
+        id_index_t<typ> _dense;
     };
 
     //------------------------------------------------------------
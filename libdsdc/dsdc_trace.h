@@ -0,0 +1,74 @@
+// -*- mode: c++; tab-width: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//-----------------------------------------------------------------------
+
+#ifndef _DSDC_TRACE_H_
+#define _DSDC_TRACE_H_
+
+#include "dsdc_prot.h"
+#include "async.h"
+#include "arpc.h"
+
+//
+// Sampled request tracing, to see where one slow request spent its
+// time, end to end.
+//
+//   A smart client traces dsdc_trace_sample_ppm per million of the
+//   GETs and fenced PUTs it sends over RPC, as GET5 and PUT7, which
+//   carry a dsdc_trace_t: the trace's ID and the span that sent it.
+//   The client records a root span for the request, and proxies,
+//   masters and slaves each record a span under the one before, as
+//   part of timing the request (see dsdc::latency::timer_t); proxies
+//   and masters pass the trace on with themselves as the parent.
+//
+//   Spans go into a ring of the last dsdc_trace_ring_sz, which
+//   GET_TRACES returns (dsdc_admin -X), and, if set_file() was given
+//   one, are appended to a file as XDR dsdc_span_t's.  Those are
+//   written when the event loop gets round to it; if the file falls
+//   dsdc_trace_file_buf bytes behind, spans are dropped from it (but
+//   not the ring).  There's no collector: put a trace back together
+//   from its spans' IDs.
+//
+//   The ring belongs to the event loop's thread, as everything else
+//   here does, so it needs no lock.
+//
+
+namespace dsdc {
+namespace trace {
+
+    class span_t {
+      public:
+        span_t() : _on(false) {
+            _s.trace_id = _s.span_id = _s.parent_id = 0;
+        }
+
+        // the first span of a new trace, if this request is sampled
+        void start_root(u_int proc);
+        // a span under <ctx>, if there's one and it's sampled
+        void start(const dsdc_trace_t* ctx, u_int proc);
+        bool
+        on() const {
+            return _on;
+        }
+        // the trace, to send on with a request to the next tier
+        void context(dsdc_trace_t* out) const;
+        // record it
+        void finish(int64_t upstream_us = 0);
+
+      private:
+        bool _on;
+        dsdc_span_t _s;
+        struct timespec _start;
+    };
+
+    // the trace <sbp> came with, or NULL if none
+    const dsdc_trace_t* context_of(svccb* sbp);
+
+    // append spans to <path> from now on; false if it can't be opened
+    bool set_file(const str& path);
+
+    // reply to GET_TRACES
+    void get_traces(svccb* sbp);
+};
+};
+
+#endif /* _DSDC_TRACE_H_ */
@@ -107,5 +107,42 @@ bool show_debug(int lev);
 str key_to_str(const dsdc_key_t& k);
 bool parse_hn(const str& in, str* host, int* port);
 
+const dsdc_key_t& dsdc_mput_key(const dsdc_mput_op_t& op);
+
 bool is_empty_checksum(const dsdc_cksum_t& cksum);
 void make_empty_checksum(dsdc_cksum_t* out);
+
+// Request deadlines (see dsdc_deadline_t in dsdc_prot.x); 0 means none.
+dsdc_deadline_t dsdc_deadline_in(u_int ms);
+u_int64_t dsdc_deadline_remaining_ms(dsdc_deadline_t d);
+bool dsdc_deadline_passed(const dsdc_deadline_t* d);
+
+// Times from sfs_get_tsnow(), in microseconds: since the epoch, from <a>
+// to <b>, and since <t> (never negative, if the clock steps back).
+inline u_int64_t
+dsdc_usec_of(const struct timespec& t) {
+    return u_int64_t(t.tv_sec) * 1000000 + t.tv_nsec / 1000;
+}
+
+inline int64_t
+dsdc_usec_between(const struct timespec& a, const struct timespec& b) {
+    return int64_t(b.tv_sec - a.tv_sec) * 1000000 +
+           (b.tv_nsec - a.tv_nsec) / 1000;
+}
+
+inline u_int64_t
+dsdc_usec_since(const struct timespec& t) {
+    int64_t d = dsdc_usec_between(t, sfs_get_tsnow());
+    return d > 0 ? d : 0;
+}
+
+// A duration for a histogram, which takes ints; 2^31us is over half an
+// hour anyway.
+inline int
+dsdc_clamp_int(int64_t v) {
+    return int(max<int64_t>(0, min<int64_t>(v, INT_MAX)));
+}
+
+// An annotation as a string, to hash, merge or label things by: "" for
+// none, and otherwise a letter for its type and then its value.
+str dsdc_annotation_key(const dsdc_annotation_t* a);
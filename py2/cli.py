@@ -5,3 +5,47 @@ import dsdc_prot
 
 c = RPC.SClient (dsdc_prot, dsdc_prot.DSDC_PROG, dsdc_prot.DSDC_VERS, 
 		 "127.0.0.1", 30002)
+
+def no_annotation():
+	a = dsdc_prot.dsdc_annotation_t()
+	a.typ = dsdc_prot.DSDC_NO_ANNOTATION
+	return a
+
+def mput(c, pairs):
+	"""Put a list of (key, obj) pairs in one DSDC_MPUT; keys are the
+	20-byte SHA1 keys dsdc uses.  Returns one dsdc_res_t per pair."""
+	ops = []
+	for k, v in pairs:
+		op = dsdc_prot.dsdc_mput_op_t()
+		op.typ = dsdc_prot.DSDC_MPUT_PUT
+		op.put = dsdc_prot.dsdc_put4_arg_t()
+		op.put.key = k
+		op.put.obj = v
+		op.put.annotation = no_annotation()
+		op.put.checksum = None
+		ops.append(op)
+	return c(dsdc_prot.DSDC_MPUT, ops)
+
+def mremove(c, keys):
+	"""Remove a list of keys in one DSDC_MREMOVE."""
+	args = []
+	for k in keys:
+		a = dsdc_prot.dsdc_remove3_arg_t()
+		a.key = k
+		a.annotation = no_annotation()
+		args.append(a)
+	return c(dsdc_prot.DSDC_MREMOVE, args)
+
+def incr(c, key, delta, initial=None):
+	"""Add <delta> to the counter at <key> with one DSDC_ATOMIC; it's
+	started at <initial>, if given and there's none.  Returns the
+	dsdc_atomic_res_t, with the counter after."""
+	a = dsdc_prot.dsdc_atomic_arg_t()
+	a.key = key
+	a.op = dsdc_prot.dsdc_atomic_op_t()
+	a.op.typ = dsdc_prot.DSDC_ATOMIC_INCR
+	a.op.incr = dsdc_prot.dsdc_incr_arg_t()
+	a.op.incr.delta = delta
+	a.op.incr.initial = initial
+	a.deadline = None
+	return c(dsdc_prot.DSDC_ATOMIC, a)
@@ -87,7 +87,7 @@ def unpack_ok_frobber_t(u):
 
 MATCHD_FRONTD_FROBBER = 0
 MATCHD_FRONTD_USERCACHE_FROBBER = 1
-UBER_USER_FROBBER = 2
+UBER_USER_OLD_FROBBER = 2
 PROFILE_STALKER_FROBBER = 3
 MATCHD_FRONTD_MATCHCACHE_FROBBER = 4
 GROUP_INFO_FROBBER = 5
@@ -101,6 +101,23 @@ MTEST_SESSION_FROBBER = 12
 MTEST_METADATA_FROBBER = 13
 MTEST_STATS_FROBBER = 14
 SETTINGS_FROBBER = 15
+PROFILE_FUZZY_MATCHES_FROBBER = 16
+AD_KEYWORD_FROBBER = 17
+
+def pack_dsdc_id_t(p, o):
+	pack_int(p, o)
+def unpack_dsdc_id_t(u):
+	return unpack_int(u)
+
+def pack_dsdc_statval_t(p, o):
+	pack_uint(p, o)
+def unpack_dsdc_statval_t(u):
+	return unpack_uint(u)
+
+def pack_dsdc_big_statval_t(p, o):
+	pack_uhyper(p, o)
+def unpack_dsdc_big_statval_t(u):
+	return unpack_uhyper(u)
 
 class dsdc_key64_t(object):
 	__slots__ = [ 'frobber', 'key64' ]
@@ -116,11 +133,11 @@ class dsdc_key64_t(object):
 		return not self == other
 def pack_dsdc_key64_t(p, o):
 	o.check()
-	pack_ok_frobber_t(p, o.frobber)
+	pack_u_int32_t(p, o.frobber)
 	pack_u_int64_t(p, o.key64)
 def unpack_dsdc_key64_t(u):
 	o = dsdc_key64_t()
-	o.frobber = unpack_ok_frobber_t(u)
+	o.frobber = unpack_u_int32_t(u)
 	o.key64 = unpack_u_int64_t(u)
 	o.check()
 	return o
@@ -141,14 +158,14 @@ class uber_key_t(object):
 		return not self == other
 def pack_uber_key_t(p, o):
 	o.check()
-	pack_ok_frobber_t(p, o.frobber)
+	pack_u_int32_t(p, o.frobber)
 	pack_u_int64_t(p, o.userid)
-	pack_u_int32_t(p, o.load_type)
+	pack_uint(p, o.load_type)
 def unpack_uber_key_t(u):
 	o = uber_key_t()
-	o.frobber = unpack_ok_frobber_t(u)
+	o.frobber = unpack_u_int32_t(u)
 	o.userid = unpack_u_int64_t(u)
-	o.load_type = unpack_u_int32_t(u)
+	o.load_type = unpack_uint(u)
 	o.check()
 	return o
 
@@ -265,7 +282,6 @@ def unpack_match_frontd_match_results_t(u):
 
 #define DSDC_KEYSIZE 20
 #define DSDC_DEFAULT_PORT 30002
-
 def pack_dsdc_key_t(p, o):
 	p.pack_fopaque(DSDC_KEYSIZE, o)
 def unpack_dsdc_key_t(u):
@@ -294,6 +310,13 @@ DSDC_TIMEOUT = 9
 DSDC_ERRDECODE = 10
 DSDC_ERRENCODE = 11
 DSDC_BAD_STATS = 12
+DSDC_DATA_CHANGED = 13
+DSDC_DATA_DISAPPEARED = 14
+DSDC_TOO_BIG = 15
+DSDC_EXPIRED = 16
+DSDC_STALE = 17
+DSDC_NOT_COUNTER = 18
+DSDC_CHUNKED = 19
 
 def pack_dsdc_annotation_type_t(p, o):
 	p.pack_uint(o)
@@ -301,18 +324,28 @@ def unpack_dsdc_annotation_type_t(u):
 	return u.unpack_uint()
 
 DSDC_NO_ANNOTATION = 0
-DSDC_INT_ANNOTATION = 1
+DSDC_CUPID_ANNOTATION = 1
+DSDC_INT_ANNOTATION = 2
+DSDC_STR_ANNOTATION = 3
 
 class dsdc_annotation_t(object):
-	__slots__ = [ 'typ', 'i' ]
+	__slots__ = [ 'typ', 'i', 'frobber', 's' ]
 	def check(self):
 		pass
 		if self.typ == DSDC_INT_ANNOTATION:
 			assert self.i is not None
+		elif self.typ == DSDC_CUPID_ANNOTATION:
+			assert self.frobber is not None
+		elif self.typ == DSDC_STR_ANNOTATION:
+			assert self.s is not None
 	def __eq__(self, other):
 		if not self.typ == other.typ: return 0
 		if self.typ == DSDC_INT_ANNOTATION:
 			if not self.i == other.i: return 0
+		elif self.typ == DSDC_CUPID_ANNOTATION:
+			if not self.frobber == other.frobber: return 0
+		elif self.typ == DSDC_STR_ANNOTATION:
+			if not self.s == other.s: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
@@ -320,59 +353,142 @@ def pack_dsdc_annotation_t(p, o):
 	o.check()
 	pack_dsdc_annotation_type_t(p, o.typ)
 	if o.typ == DSDC_INT_ANNOTATION:
-		pack_int32_t(p, o.i)
+		pack_int(p, o.i)
+	elif o.typ == DSDC_CUPID_ANNOTATION:
+		pack_ok_frobber_t(p, o.frobber)
+	elif o.typ == DSDC_STR_ANNOTATION:
+		p.pack_string(o.s)
 def unpack_dsdc_annotation_t(u):
 	o = dsdc_annotation_t()
 	o.typ = unpack_dsdc_annotation_type_t(u)
 	if o.typ == DSDC_INT_ANNOTATION:
-		o.i = unpack_int32_t(u)
+		o.i = unpack_int(u)
+	elif o.typ == DSDC_CUPID_ANNOTATION:
+		o.frobber = unpack_ok_frobber_t(u)
+	elif o.typ == DSDC_STR_ANNOTATION:
+		o.s = u.unpack_string()
 	o.check()
 	return o
 
 class dsdc_histogram_t(object):
-	__slots__ = [ 'scale_factor', 'avg', 'min', 'max', 'buckets' ]
+	__slots__ = [ 'scale_factor', 'samples', 'avg', 'min', 'max', 'buckets', 'total' ]
 	def check(self):
 		pass
 		assert self.scale_factor is not None
+		assert self.samples is not None
 		assert self.avg is not None
 		assert self.min is not None
 		assert self.max is not None
 		assert self.buckets is not None
+		assert self.total is not None
 	def __eq__(self, other):
 		if not self.scale_factor == other.scale_factor: return 0
+		if not self.samples == other.samples: return 0
 		if not self.avg == other.avg: return 0
 		if not self.min == other.min: return 0
 		if not self.max == other.max: return 0
 		if not self.buckets == other.buckets: return 0
+		if not self.total == other.total: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
 def pack_dsdc_histogram_t(p, o):
 	o.check()
-	pack_int64_t(p, o.scale_factor)
-	pack_int64_t(p, o.avg)
-	pack_int64_t(p, o.min)
-	pack_int64_t(p, o.max)
-	p.pack_array(o.buckets, lambda x: pack_u_int32_t(p, x))
+	pack_hyper(p, o.scale_factor)
+	pack_uint(p, o.samples)
+	pack_hyper(p, o.avg)
+	pack_hyper(p, o.min)
+	pack_hyper(p, o.max)
+	p.pack_array(o.buckets, lambda x: pack_uint(p, x))
+	pack_hyper(p, o.total)
 def unpack_dsdc_histogram_t(u):
 	o = dsdc_histogram_t()
-	o.scale_factor = unpack_int64_t(u)
-	o.avg = unpack_int64_t(u)
-	o.min = unpack_int64_t(u)
-	o.max = unpack_int64_t(u)
-	o.buckets = u.unpack_array(lambda : unpack_u_int32_t(u))
+	o.scale_factor = unpack_hyper(u)
+	o.samples = unpack_uint(u)
+	o.avg = unpack_hyper(u)
+	o.min = unpack_hyper(u)
+	o.max = unpack_hyper(u)
+	o.buckets = u.unpack_array(lambda : unpack_uint(u))
+	o.total = unpack_hyper(u)
+	o.check()
+	return o
+
+class dsdc_hist_bucket_t(object):
+	__slots__ = [ 'idx', 'count' ]
+	def check(self):
+		pass
+		assert self.idx is not None
+		assert self.count is not None
+	def __eq__(self, other):
+		if not self.idx == other.idx: return 0
+		if not self.count == other.count: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_hist_bucket_t(p, o):
+	o.check()
+	pack_uint(p, o.idx)
+	pack_uhyper(p, o.count)
+def unpack_dsdc_hist_bucket_t(u):
+	o = dsdc_hist_bucket_t()
+	o.idx = unpack_uint(u)
+	o.count = unpack_uhyper(u)
+	o.check()
+	return o
+
+class dsdc_histogram2_t(object):
+	__slots__ = [ 'hist', 'p50', 'p99', 'p999', 'sketch_bits', 'sketch' ]
+	def check(self):
+		pass
+		assert self.hist is not None
+		assert self.p50 is not None
+		assert self.p99 is not None
+		assert self.p999 is not None
+		assert self.sketch_bits is not None
+		assert self.sketch is not None
+	def __eq__(self, other):
+		if not self.hist == other.hist: return 0
+		if not self.p50 == other.p50: return 0
+		if not self.p99 == other.p99: return 0
+		if not self.p999 == other.p999: return 0
+		if not self.sketch_bits == other.sketch_bits: return 0
+		if not self.sketch == other.sketch: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_histogram2_t(p, o):
+	o.check()
+	pack_dsdc_histogram_t(p, o.hist)
+	pack_hyper(p, o.p50)
+	pack_hyper(p, o.p99)
+	pack_hyper(p, o.p999)
+	pack_uint(p, o.sketch_bits)
+	p.pack_array(o.sketch, lambda x: pack_dsdc_hist_bucket_t(p, x))
+def unpack_dsdc_histogram2_t(u):
+	o = dsdc_histogram2_t()
+	o.hist = unpack_dsdc_histogram_t(u)
+	o.p50 = unpack_hyper(u)
+	o.p99 = unpack_hyper(u)
+	o.p999 = unpack_hyper(u)
+	o.sketch_bits = unpack_uint(u)
+	o.sketch = u.unpack_array(lambda : unpack_dsdc_hist_bucket_t(u))
 	o.check()
 	return o
 
 class dsdc_dataset_t(object):
-	__slots__ = [ 'creations', 'puts', 'missed_gets', 'gets', 'lifetime', 'objsz', 'do_gets', 'do_lifetime', 'do_objsz' ]
+	__slots__ = [ 'creations', 'puts', 'missed_gets', 'missed_removes', 'rm_explicit', 'rm_make_room', 'rm_clean', 'rm_replace', 'duration', 'gets', 'objsz', 'do_gets', 'do_lifetime', 'do_objsz', 'lifetime', 'n_active' ]
 	def check(self):
 		pass
 		assert self.creations is not None
 		assert self.puts is not None
 		assert self.missed_gets is not None
+		assert self.missed_removes is not None
+		assert self.rm_explicit is not None
+		assert self.rm_make_room is not None
+		assert self.rm_clean is not None
+		assert self.rm_replace is not None
+		assert self.duration is not None
 		assert self.gets is not None
-		assert self.lifetime is not None
 		assert self.objsz is not None
 		assert self.do_gets is not None
 		assert self.do_lifetime is not None
@@ -381,37 +497,58 @@ class dsdc_dataset_t(object):
 		if not self.creations == other.creations: return 0
 		if not self.puts == other.puts: return 0
 		if not self.missed_gets == other.missed_gets: return 0
+		if not self.missed_removes == other.missed_removes: return 0
+		if not self.rm_explicit == other.rm_explicit: return 0
+		if not self.rm_make_room == other.rm_make_room: return 0
+		if not self.rm_clean == other.rm_clean: return 0
+		if not self.rm_replace == other.rm_replace: return 0
+		if not self.duration == other.duration: return 0
 		if not self.gets == other.gets: return 0
-		if not self.lifetime == other.lifetime: return 0
 		if not self.objsz == other.objsz: return 0
 		if not self.do_gets == other.do_gets: return 0
 		if not self.do_lifetime == other.do_lifetime: return 0
 		if not self.do_objsz == other.do_objsz: return 0
+		if not self.lifetime == other.lifetime: return 0
+		if not self.n_active == other.n_active: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
 def pack_dsdc_dataset_t(p, o):
 	o.check()
-	pack_int64_t(p, o.creations)
-	pack_int64_t(p, o.puts)
-	pack_int64_t(p, o.missed_gets)
+	pack_hyper(p, o.creations)
+	pack_hyper(p, o.puts)
+	pack_hyper(p, o.missed_gets)
+	pack_hyper(p, o.missed_removes)
+	pack_hyper(p, o.rm_explicit)
+	pack_hyper(p, o.rm_make_room)
+	pack_hyper(p, o.rm_clean)
+	pack_hyper(p, o.rm_replace)
+	pack_uint(p, o.duration)
 	pack_dsdc_histogram_t(p, o.gets)
-	pack_dsdc_histogram_t(p, o.lifetime)
 	pack_dsdc_histogram_t(p, o.objsz)
 	pack_dsdc_histogram_t(p, o.do_gets)
 	pack_dsdc_histogram_t(p, o.do_lifetime)
 	pack_dsdc_histogram_t(p, o.do_objsz)
+	pack_ptr(p, o.lifetime, lambda x: pack_dsdc_histogram_t(p, x))
+	pack_ptr(p, o.n_active, lambda x: pack_hyper(p, x))
 def unpack_dsdc_dataset_t(u):
 	o = dsdc_dataset_t()
-	o.creations = unpack_int64_t(u)
-	o.puts = unpack_int64_t(u)
-	o.missed_gets = unpack_int64_t(u)
+	o.creations = unpack_hyper(u)
+	o.puts = unpack_hyper(u)
+	o.missed_gets = unpack_hyper(u)
+	o.missed_removes = unpack_hyper(u)
+	o.rm_explicit = unpack_hyper(u)
+	o.rm_make_room = unpack_hyper(u)
+	o.rm_clean = unpack_hyper(u)
+	o.rm_replace = unpack_hyper(u)
+	o.duration = unpack_uint(u)
 	o.gets = unpack_dsdc_histogram_t(u)
-	o.lifetime = unpack_dsdc_histogram_t(u)
 	o.objsz = unpack_dsdc_histogram_t(u)
 	o.do_gets = unpack_dsdc_histogram_t(u)
 	o.do_lifetime = unpack_dsdc_histogram_t(u)
 	o.do_objsz = unpack_dsdc_histogram_t(u)
+	o.lifetime = unpack_ptr(u, lambda : unpack_dsdc_histogram_t(u))
+	o.n_active = unpack_ptr(u, lambda : unpack_hyper(u))
 	o.check()
 	return o
 
@@ -447,6 +584,115 @@ def pack_dsdc_statistics_t(p, o):
 def unpack_dsdc_statistics_t(u):
 	return u.unpack_array(lambda : unpack_dsdc_statistic_t(u))
 
+class dsdc_dataset2_t(object):
+	__slots__ = [ 'creations', 'puts', 'missed_gets', 'missed_removes', 'rm_explicit', 'rm_make_room', 'rm_clean', 'rm_replace', 'duration', 'gets', 'objsz', 'do_gets', 'do_lifetime', 'do_objsz', 'lifetime', 'n_active' ]
+	def check(self):
+		pass
+		assert self.creations is not None
+		assert self.puts is not None
+		assert self.missed_gets is not None
+		assert self.missed_removes is not None
+		assert self.rm_explicit is not None
+		assert self.rm_make_room is not None
+		assert self.rm_clean is not None
+		assert self.rm_replace is not None
+		assert self.duration is not None
+		assert self.gets is not None
+		assert self.objsz is not None
+		assert self.do_gets is not None
+		assert self.do_lifetime is not None
+		assert self.do_objsz is not None
+	def __eq__(self, other):
+		if not self.creations == other.creations: return 0
+		if not self.puts == other.puts: return 0
+		if not self.missed_gets == other.missed_gets: return 0
+		if not self.missed_removes == other.missed_removes: return 0
+		if not self.rm_explicit == other.rm_explicit: return 0
+		if not self.rm_make_room == other.rm_make_room: return 0
+		if not self.rm_clean == other.rm_clean: return 0
+		if not self.rm_replace == other.rm_replace: return 0
+		if not self.duration == other.duration: return 0
+		if not self.gets == other.gets: return 0
+		if not self.objsz == other.objsz: return 0
+		if not self.do_gets == other.do_gets: return 0
+		if not self.do_lifetime == other.do_lifetime: return 0
+		if not self.do_objsz == other.do_objsz: return 0
+		if not self.lifetime == other.lifetime: return 0
+		if not self.n_active == other.n_active: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_dataset2_t(p, o):
+	o.check()
+	pack_hyper(p, o.creations)
+	pack_hyper(p, o.puts)
+	pack_hyper(p, o.missed_gets)
+	pack_hyper(p, o.missed_removes)
+	pack_hyper(p, o.rm_explicit)
+	pack_hyper(p, o.rm_make_room)
+	pack_hyper(p, o.rm_clean)
+	pack_hyper(p, o.rm_replace)
+	pack_uint(p, o.duration)
+	pack_dsdc_histogram2_t(p, o.gets)
+	pack_dsdc_histogram2_t(p, o.objsz)
+	pack_dsdc_histogram2_t(p, o.do_gets)
+	pack_dsdc_histogram2_t(p, o.do_lifetime)
+	pack_dsdc_histogram2_t(p, o.do_objsz)
+	pack_ptr(p, o.lifetime, lambda x: pack_dsdc_histogram2_t(p, x))
+	pack_ptr(p, o.n_active, lambda x: pack_hyper(p, x))
+def unpack_dsdc_dataset2_t(u):
+	o = dsdc_dataset2_t()
+	o.creations = unpack_hyper(u)
+	o.puts = unpack_hyper(u)
+	o.missed_gets = unpack_hyper(u)
+	o.missed_removes = unpack_hyper(u)
+	o.rm_explicit = unpack_hyper(u)
+	o.rm_make_room = unpack_hyper(u)
+	o.rm_clean = unpack_hyper(u)
+	o.rm_replace = unpack_hyper(u)
+	o.duration = unpack_uint(u)
+	o.gets = unpack_dsdc_histogram2_t(u)
+	o.objsz = unpack_dsdc_histogram2_t(u)
+	o.do_gets = unpack_dsdc_histogram2_t(u)
+	o.do_lifetime = unpack_dsdc_histogram2_t(u)
+	o.do_objsz = unpack_dsdc_histogram2_t(u)
+	o.lifetime = unpack_ptr(u, lambda : unpack_dsdc_histogram2_t(u))
+	o.n_active = unpack_ptr(u, lambda : unpack_hyper(u))
+	o.check()
+	return o
+
+class dsdc_statistic2_t(object):
+	__slots__ = [ 'annotation', 'epoch_data', 'alltime_data' ]
+	def check(self):
+		pass
+		assert self.annotation is not None
+		assert self.epoch_data is not None
+		assert self.alltime_data is not None
+	def __eq__(self, other):
+		if not self.annotation == other.annotation: return 0
+		if not self.epoch_data == other.epoch_data: return 0
+		if not self.alltime_data == other.alltime_data: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_statistic2_t(p, o):
+	o.check()
+	pack_dsdc_annotation_t(p, o.annotation)
+	pack_dsdc_dataset2_t(p, o.epoch_data)
+	pack_dsdc_dataset2_t(p, o.alltime_data)
+def unpack_dsdc_statistic2_t(u):
+	o = dsdc_statistic2_t()
+	o.annotation = unpack_dsdc_annotation_t(u)
+	o.epoch_data = unpack_dsdc_dataset2_t(u)
+	o.alltime_data = unpack_dsdc_dataset2_t(u)
+	o.check()
+	return o
+
+def pack_dsdc_statistics2_t(p, o):
+	p.pack_array(o, lambda x: pack_dsdc_statistic2_t(p, x))
+def unpack_dsdc_statistics2_t(u):
+	return u.unpack_array(lambda : unpack_dsdc_statistic2_t(u))
+
 class dsdc_dataset_params_t(object):
 	__slots__ = [ 'lifetime_n_buckets', 'gets_n_buckets', 'objsz_n_buckets' ]
 	def check(self):
@@ -463,14 +709,14 @@ class dsdc_dataset_params_t(object):
 		return not self == other
 def pack_dsdc_dataset_params_t(p, o):
 	o.check()
-	pack_u_int32_t(p, o.lifetime_n_buckets)
-	pack_u_int32_t(p, o.gets_n_buckets)
-	pack_u_int32_t(p, o.objsz_n_buckets)
+	pack_uint(p, o.lifetime_n_buckets)
+	pack_uint(p, o.gets_n_buckets)
+	pack_uint(p, o.objsz_n_buckets)
 def unpack_dsdc_dataset_params_t(u):
 	o = dsdc_dataset_params_t()
-	o.lifetime_n_buckets = unpack_u_int32_t(u)
-	o.gets_n_buckets = unpack_u_int32_t(u)
-	o.objsz_n_buckets = unpack_u_int32_t(u)
+	o.lifetime_n_buckets = unpack_uint(u)
+	o.gets_n_buckets = unpack_uint(u)
+	o.objsz_n_buckets = unpack_uint(u)
 	o.check()
 	return o
 
@@ -512,18 +758,18 @@ DSDC_SET_NONE = 0
 DSDC_SET_ALL = 1
 DSDC_SET_SOME = 2
 DSDC_SET_RANDOM = 3
+DSDC_SET_FIRST = 4
 
 class dsdc_slaveset_t(object):
-	__slots__ = [ 'typ', 'hosts' ]
+	__slots__ = [ 'typ', 'some' ]
 	def check(self):
 		pass
-		assert self.typ is not None
 		if self.typ == DSDC_SET_SOME:
-			assert self.hosts is not None
+			assert self.some is not None
 	def __eq__(self, other):
 		if not self.typ == other.typ: return 0
 		if self.typ == DSDC_SET_SOME:
-			if not self.hosts == other.hosts: return 0
+			if not self.some == other.some: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
@@ -531,12 +777,12 @@ def pack_dsdc_slaveset_t(p, o):
 	o.check()
 	pack_dsdc_settype_t(p, o.typ)
 	if o.typ == DSDC_SET_SOME:
-		pack_dsdc_hostnames_t(p, o.hosts)
+		pack_dsdc_hostnames_t(p, o.some)
 def unpack_dsdc_slaveset_t(u):
 	o = dsdc_slaveset_t()
 	o.typ = unpack_dsdc_settype_t(u)
 	if o.typ == DSDC_SET_SOME:
-		o.hosts = unpack_dsdc_hostnames_t(u)
+		o.some = unpack_dsdc_hostnames_t(u)
 	o.check()
 	return o
 
@@ -589,6 +835,32 @@ def unpack_dsdc_get_stats_single_res_t(u):
 	o.check()
 	return o
 
+class dsdc_get_stats_single2_res_t(object):
+	__slots__ = [ 'status', 'stats' ]
+	def check(self):
+		pass
+		if self.status == DSDC_OK:
+			assert self.stats is not None
+	def __eq__(self, other):
+		if not self.status == other.status: return 0
+		if self.status == DSDC_OK:
+			if not self.stats == other.stats: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get_stats_single2_res_t(p, o):
+	o.check()
+	pack_dsdc_res_t(p, o.status)
+	if o.status == DSDC_OK:
+		pack_dsdc_statistics2_t(p, o.stats)
+def unpack_dsdc_get_stats_single2_res_t(u):
+	o = dsdc_get_stats_single2_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	if o.status == DSDC_OK:
+		o.stats = unpack_dsdc_statistics2_t(u)
+	o.check()
+	return o
+
 class dsdc_slave_statistic_t(object):
 	__slots__ = [ 'host', 'stats' ]
 	def check(self):
@@ -617,416 +889,2610 @@ def pack_dsdc_slave_statistics_t(p, o):
 def unpack_dsdc_slave_statistics_t(u):
 	return u.unpack_array(lambda : unpack_dsdc_slave_statistic_t(u))
 
-class dsdc_req_t(object):
-	__slots__ = [ 'key', 'time_to_expire' ]
+class dsdc_get_stats_agg_arg_t(object):
+	__slots__ = [ 'hosts', 'getparams', 'timeout_ms', 'n_outliers' ]
 	def check(self):
 		pass
-		assert self.key is not None
-		assert self.time_to_expire is not None
+		assert self.hosts is not None
+		assert self.getparams is not None
+		assert self.timeout_ms is not None
+		assert self.n_outliers is not None
 	def __eq__(self, other):
-		if not self.key == other.key: return 0
-		if not self.time_to_expire == other.time_to_expire: return 0
+		if not self.hosts == other.hosts: return 0
+		if not self.getparams == other.getparams: return 0
+		if not self.timeout_ms == other.timeout_ms: return 0
+		if not self.n_outliers == other.n_outliers: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdc_req_t(p, o):
+def pack_dsdc_get_stats_agg_arg_t(p, o):
 	o.check()
-	pack_dsdc_key_t(p, o.key)
-	pack_int32_t(p, o.time_to_expire)
-def unpack_dsdc_req_t(u):
-	o = dsdc_req_t()
-	o.key = unpack_dsdc_key_t(u)
-	o.time_to_expire = unpack_int32_t(u)
+	pack_dsdc_slaveset_t(p, o.hosts)
+	pack_dsdc_get_stats_single_arg_t(p, o.getparams)
+	pack_uint(p, o.timeout_ms)
+	pack_uint(p, o.n_outliers)
+def unpack_dsdc_get_stats_agg_arg_t(u):
+	o = dsdc_get_stats_agg_arg_t()
+	o.hosts = unpack_dsdc_slaveset_t(u)
+	o.getparams = unpack_dsdc_get_stats_single_arg_t(u)
+	o.timeout_ms = unpack_uint(u)
+	o.n_outliers = unpack_uint(u)
 	o.check()
 	return o
 
-def pack_dsdc_custom_t(p, o):
-	p.pack_opaque(o)
-def unpack_dsdc_custom_t(u):
-	return u.unpack_opaque()
-
-class dsdc_key_template_t(object):
-	__slots__ = [ 'id', 'pid', 'port', 'hostname' ]
+class dsdc_slave_failure_t(object):
+	__slots__ = [ 'host', 'status' ]
 	def check(self):
 		pass
-		assert self.id is not None
-		assert self.pid is not None
-		assert self.port is not None
-		assert self.hostname is not None
+		assert self.host is not None
+		assert self.status is not None
 	def __eq__(self, other):
-		if not self.id == other.id: return 0
-		if not self.pid == other.pid: return 0
-		if not self.port == other.port: return 0
-		if not self.hostname == other.hostname: return 0
+		if not self.host == other.host: return 0
+		if not self.status == other.status: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdc_key_template_t(p, o):
+def pack_dsdc_slave_failure_t(p, o):
 	o.check()
-	pack_u_int32_t(p, o.id)
-	pack_u_int32_t(p, o.pid)
-	pack_u_int32_t(p, o.port)
-	p.pack_string(o.hostname)
-def unpack_dsdc_key_template_t(u):
-	o = dsdc_key_template_t()
-	o.id = unpack_u_int32_t(u)
-	o.pid = unpack_u_int32_t(u)
-	o.port = unpack_u_int32_t(u)
-	o.hostname = u.unpack_string()
+	pack_dsdc_hostname_t(p, o.host)
+	pack_dsdc_res_t(p, o.status)
+def unpack_dsdc_slave_failure_t(u):
+	o = dsdc_slave_failure_t()
+	o.host = unpack_dsdc_hostname_t(u)
+	o.status = unpack_dsdc_res_t(u)
 	o.check()
 	return o
 
-def pack_dsdc_obj_t(p, o):
-	p.pack_opaque(o)
-def unpack_dsdc_obj_t(u):
-	return u.unpack_opaque()
-
-class dsdc_put_arg_t(object):
-	__slots__ = [ 'key', 'obj' ]
+class dsdc_stats_outlier_t(object):
+	__slots__ = [ 'host', 'what', 'value', 'median' ]
 	def check(self):
 		pass
-		assert self.key is not None
-		assert self.obj is not None
+		assert self.host is not None
+		assert self.what is not None
+		assert self.value is not None
+		assert self.median is not None
 	def __eq__(self, other):
-		if not self.key == other.key: return 0
-		if not self.obj == other.obj: return 0
+		if not self.host == other.host: return 0
+		if not self.what == other.what: return 0
+		if not self.value == other.value: return 0
+		if not self.median == other.median: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdc_put_arg_t(p, o):
+def pack_dsdc_stats_outlier_t(p, o):
 	o.check()
-	pack_dsdc_key_t(p, o.key)
-	pack_dsdc_obj_t(p, o.obj)
-def unpack_dsdc_put_arg_t(u):
-	o = dsdc_put_arg_t()
-	o.key = unpack_dsdc_key_t(u)
-	o.obj = unpack_dsdc_obj_t(u)
+	pack_dsdc_hostname_t(p, o.host)
+	p.pack_string(o.what)
+	pack_hyper(p, o.value)
+	pack_hyper(p, o.median)
+def unpack_dsdc_stats_outlier_t(u):
+	o = dsdc_stats_outlier_t()
+	o.host = unpack_dsdc_hostname_t(u)
+	o.what = u.unpack_string()
+	o.value = unpack_hyper(u)
+	o.median = unpack_hyper(u)
 	o.check()
 	return o
 
-class dsdc_get_res_t(object):
-	__slots__ = [ 'status', 'obj', 'err' ]
+class dsdc_stats_agg_t(object):
+	__slots__ = [ 'n_slaves', 'n_merged', 'stats', 'outliers', 'failed' ]
 	def check(self):
 		pass
-		if self.status == DSDC_OK:
-			assert self.obj is not None
-		elif self.status == DSDC_RPC_ERROR:
-			assert self.err is not None
+		assert self.n_slaves is not None
+		assert self.n_merged is not None
+		assert self.stats is not None
+		assert self.outliers is not None
+		assert self.failed is not None
 	def __eq__(self, other):
-		if not self.status == other.status: return 0
-		if self.status == DSDC_OK:
-			if not self.obj == other.obj: return 0
-		elif self.status == DSDC_RPC_ERROR:
-			if not self.err == other.err: return 0
+		if not self.n_slaves == other.n_slaves: return 0
+		if not self.n_merged == other.n_merged: return 0
+		if not self.stats == other.stats: return 0
+		if not self.outliers == other.outliers: return 0
+		if not self.failed == other.failed: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdc_get_res_t(p, o):
+def pack_dsdc_stats_agg_t(p, o):
 	o.check()
-	pack_dsdc_res_t(p, o.status)
-	if o.status == DSDC_OK:
-		pack_dsdc_obj_t(p, o.obj)
-	elif o.status == DSDC_RPC_ERROR:
-		pack_u_int32_t(p, o.err)
-def unpack_dsdc_get_res_t(u):
-	o = dsdc_get_res_t()
-	o.status = unpack_dsdc_res_t(u)
-	if o.status == DSDC_OK:
-		o.obj = unpack_dsdc_obj_t(u)
-	elif o.status == DSDC_RPC_ERROR:
-		o.err = unpack_u_int32_t(u)
+	pack_uint(p, o.n_slaves)
+	pack_uint(p, o.n_merged)
+	pack_dsdc_statistics2_t(p, o.stats)
+	p.pack_array(o.outliers, lambda x: pack_dsdc_stats_outlier_t(p, x))
+	p.pack_array(o.failed, lambda x: pack_dsdc_slave_failure_t(p, x))
+def unpack_dsdc_stats_agg_t(u):
+	o = dsdc_stats_agg_t()
+	o.n_slaves = unpack_uint(u)
+	o.n_merged = unpack_uint(u)
+	o.stats = unpack_dsdc_statistics2_t(u)
+	o.outliers = u.unpack_array(lambda : unpack_dsdc_stats_outlier_t(u))
+	o.failed = u.unpack_array(lambda : unpack_dsdc_slave_failure_t(u))
 	o.check()
 	return o
 
-class dsdc_mget_1res_t(object):
-	__slots__ = [ 'key', 'res' ]
+class dsdc_get_stats_agg_res_t(object):
+	__slots__ = [ 'status', 'agg' ]
 	def check(self):
 		pass
-		assert self.key is not None
-		assert self.res is not None
+		if self.status == DSDC_OK:
+			assert self.agg is not None
 	def __eq__(self, other):
-		if not self.key == other.key: return 0
-		if not self.res == other.res: return 0
+		if not self.status == other.status: return 0
+		if self.status == DSDC_OK:
+			if not self.agg == other.agg: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdc_mget_1res_t(p, o):
+def pack_dsdc_get_stats_agg_res_t(p, o):
 	o.check()
-	pack_dsdc_key_t(p, o.key)
-	pack_dsdc_get_res_t(p, o.res)
-def unpack_dsdc_mget_1res_t(u):
-	o = dsdc_mget_1res_t()
-	o.key = unpack_dsdc_key_t(u)
-	o.res = unpack_dsdc_get_res_t(u)
+	pack_dsdc_res_t(p, o.status)
+	if o.status == DSDC_OK:
+		pack_dsdc_stats_agg_t(p, o.agg)
+def unpack_dsdc_get_stats_agg_res_t(u):
+	o = dsdc_get_stats_agg_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	if o.status == DSDC_OK:
+		o.agg = unpack_dsdc_stats_agg_t(u)
 	o.check()
 	return o
 
-def pack_dsdc_mget_res_t(p, o):
-	p.pack_array(o, lambda x: pack_dsdc_mget_1res_t(p, x))
-def unpack_dsdc_mget_res_t(u):
-	return u.unpack_array(lambda : unpack_dsdc_mget_1res_t(u))
-
-def pack_dsdc_mget_arg_t(p, o):
-	p.pack_array(o, lambda x: pack_dsdc_key_t(p, x))
-def unpack_dsdc_mget_arg_t(u):
-	return u.unpack_array(lambda : unpack_dsdc_key_t(u))
-
-def pack_dsdc_mget2_arg_t(p, o):
-	p.pack_array(o, lambda x: pack_dsdc_req_t(p, x))
-def unpack_dsdc_mget2_arg_t(u):
-	return u.unpack_array(lambda : unpack_dsdc_req_t(u))
-
-def pack_dsdc_get_arg_t(p, o):
-	pack_dsdc_key_t(p, o)
-def unpack_dsdc_get_arg_t(u):
-	return unpack_dsdc_key_t(u)
-
-class dsdc_get3_arg_t(object):
-	__slots__ = [ 'key', 'time_to_expire', 'annotation' ]
+class dsdc_latency_stat_t(object):
+	__slots__ = [ 'proc', 'annotation', 'queue', 'service', 'upstream' ]
 	def check(self):
 		pass
-		assert self.key is not None
-		assert self.time_to_expire is not None
+		assert self.proc is not None
 		assert self.annotation is not None
+		assert self.queue is not None
+		assert self.service is not None
+		assert self.upstream is not None
 	def __eq__(self, other):
-		if not self.key == other.key: return 0
-		if not self.time_to_expire == other.time_to_expire: return 0
+		if not self.proc == other.proc: return 0
 		if not self.annotation == other.annotation: return 0
+		if not self.queue == other.queue: return 0
+		if not self.service == other.service: return 0
+		if not self.upstream == other.upstream: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdc_get3_arg_t(p, o):
+def pack_dsdc_latency_stat_t(p, o):
 	o.check()
-	pack_dsdc_key_t(p, o.key)
-	pack_int32_t(p, o.time_to_expire)
+	pack_uint(p, o.proc)
 	pack_dsdc_annotation_t(p, o.annotation)
-def unpack_dsdc_get3_arg_t(u):
-	o = dsdc_get3_arg_t()
-	o.key = unpack_dsdc_key_t(u)
-	o.time_to_expire = unpack_int32_t(u)
+	pack_dsdc_histogram2_t(p, o.queue)
+	pack_dsdc_histogram2_t(p, o.service)
+	pack_dsdc_histogram2_t(p, o.upstream)
+def unpack_dsdc_latency_stat_t(u):
+	o = dsdc_latency_stat_t()
+	o.proc = unpack_uint(u)
 	o.annotation = unpack_dsdc_annotation_t(u)
+	o.queue = unpack_dsdc_histogram2_t(u)
+	o.service = unpack_dsdc_histogram2_t(u)
+	o.upstream = unpack_dsdc_histogram2_t(u)
 	o.check()
 	return o
 
-def pack_dsdc_mget3_arg_t(p, o):
-	p.pack_array(o, lambda x: pack_dsdc_get3_arg_t(p, x))
-def unpack_dsdc_mget3_arg_t(u):
-	return u.unpack_array(lambda : unpack_dsdc_get3_arg_t(u))
-
-class dsdc_put3_arg_t(object):
-	__slots__ = [ 'key', 'obj', 'annotation' ]
+class dsdc_get_latency_stats_arg_t(object):
+	__slots__ = [ 'n_buckets', 'reset' ]
 	def check(self):
 		pass
-		assert self.key is not None
-		assert self.obj is not None
-		assert self.annotation is not None
+		assert self.n_buckets is not None
+		assert self.reset is not None
 	def __eq__(self, other):
-		if not self.key == other.key: return 0
-		if not self.obj == other.obj: return 0
-		if not self.annotation == other.annotation: return 0
+		if not self.n_buckets == other.n_buckets: return 0
+		if not self.reset == other.reset: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdc_put3_arg_t(p, o):
+def pack_dsdc_get_latency_stats_arg_t(p, o):
 	o.check()
-	pack_dsdc_key_t(p, o.key)
-	pack_dsdc_obj_t(p, o.obj)
-	pack_dsdc_annotation_t(p, o.annotation)
-def unpack_dsdc_put3_arg_t(u):
-	o = dsdc_put3_arg_t()
+	pack_uint(p, o.n_buckets)
+	pack_bool(p, o.reset)
+def unpack_dsdc_get_latency_stats_arg_t(u):
+	o = dsdc_get_latency_stats_arg_t()
+	o.n_buckets = unpack_uint(u)
+	o.reset = unpack_bool(u)
+	o.check()
+	return o
+
+class dsdc_get_latency_stats_res_t(object):
+	__slots__ = [ 'status', 'stats' ]
+	def check(self):
+		pass
+		if self.status == DSDC_OK:
+			assert self.stats is not None
+	def __eq__(self, other):
+		if not self.status == other.status: return 0
+		if self.status == DSDC_OK:
+			if not self.stats == other.stats: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get_latency_stats_res_t(p, o):
+	o.check()
+	pack_dsdc_res_t(p, o.status)
+	if o.status == DSDC_OK:
+		p.pack_array(o.stats, lambda x: pack_dsdc_latency_stat_t(p, x))
+def unpack_dsdc_get_latency_stats_res_t(u):
+	o = dsdc_get_latency_stats_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	if o.status == DSDC_OK:
+		o.stats = u.unpack_array(lambda : unpack_dsdc_latency_stat_t(u))
+	o.check()
+	return o
+
+class dsdc_hotkey_t(object):
+	__slots__ = [ 'key', 'count', 'error' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.count is not None
+		assert self.error is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.count == other.count: return 0
+		if not self.error == other.error: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_hotkey_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_uhyper(p, o.count)
+	pack_uhyper(p, o.error)
+def unpack_dsdc_hotkey_t(u):
+	o = dsdc_hotkey_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.count = unpack_uhyper(u)
+	o.error = unpack_uhyper(u)
+	o.check()
+	return o
+
+class dsdc_hotkeys_t(object):
+	__slots__ = [ 'window_ms', 'keys' ]
+	def check(self):
+		pass
+		assert self.window_ms is not None
+		assert self.keys is not None
+	def __eq__(self, other):
+		if not self.window_ms == other.window_ms: return 0
+		if not self.keys == other.keys: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_hotkeys_t(p, o):
+	o.check()
+	pack_uhyper(p, o.window_ms)
+	p.pack_array(o.keys, lambda x: pack_dsdc_hotkey_t(p, x))
+def unpack_dsdc_hotkeys_t(u):
+	o = dsdc_hotkeys_t()
+	o.window_ms = unpack_uhyper(u)
+	o.keys = u.unpack_array(lambda : unpack_dsdc_hotkey_t(u))
+	o.check()
+	return o
+
+class dsdc_hotkeys_stats_t(object):
+	__slots__ = [ 'reads', 'writes' ]
+	def check(self):
+		pass
+		assert self.reads is not None
+		assert self.writes is not None
+	def __eq__(self, other):
+		if not self.reads == other.reads: return 0
+		if not self.writes == other.writes: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_hotkeys_stats_t(p, o):
+	o.check()
+	pack_dsdc_hotkeys_t(p, o.reads)
+	pack_dsdc_hotkeys_t(p, o.writes)
+def unpack_dsdc_hotkeys_stats_t(u):
+	o = dsdc_hotkeys_stats_t()
+	o.reads = unpack_dsdc_hotkeys_t(u)
+	o.writes = unpack_dsdc_hotkeys_t(u)
+	o.check()
+	return o
+
+class dsdc_get_hotkeys_arg_t(object):
+	__slots__ = [ 'n', 'reset' ]
+	def check(self):
+		pass
+		assert self.n is not None
+		assert self.reset is not None
+	def __eq__(self, other):
+		if not self.n == other.n: return 0
+		if not self.reset == other.reset: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get_hotkeys_arg_t(p, o):
+	o.check()
+	pack_uint(p, o.n)
+	pack_bool(p, o.reset)
+def unpack_dsdc_get_hotkeys_arg_t(u):
+	o = dsdc_get_hotkeys_arg_t()
+	o.n = unpack_uint(u)
+	o.reset = unpack_bool(u)
+	o.check()
+	return o
+
+class dsdc_get_hotkeys_res_t(object):
+	__slots__ = [ 'status', 'hot' ]
+	def check(self):
+		pass
+		if self.status == DSDC_OK:
+			assert self.hot is not None
+	def __eq__(self, other):
+		if not self.status == other.status: return 0
+		if self.status == DSDC_OK:
+			if not self.hot == other.hot: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get_hotkeys_res_t(p, o):
+	o.check()
+	pack_dsdc_res_t(p, o.status)
+	if o.status == DSDC_OK:
+		pack_dsdc_hotkeys_stats_t(p, o.hot)
+def unpack_dsdc_get_hotkeys_res_t(u):
+	o = dsdc_get_hotkeys_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	if o.status == DSDC_OK:
+		o.hot = unpack_dsdc_hotkeys_stats_t(u)
+	o.check()
+	return o
+
+class dsdc_mrc_t(object):
+	__slots__ = [ 'annotation', 'refs', 'hits' ]
+	def check(self):
+		pass
+		assert self.annotation is not None
+		assert self.refs is not None
+		assert self.hits is not None
+	def __eq__(self, other):
+		if not self.annotation == other.annotation: return 0
+		if not self.refs == other.refs: return 0
+		if not self.hits == other.hits: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_mrc_t(p, o):
+	o.check()
+	pack_dsdc_annotation_t(p, o.annotation)
+	pack_uhyper(p, o.refs)
+	p.pack_array(o.hits, lambda x: pack_uhyper(p, x))
+def unpack_dsdc_mrc_t(u):
+	o = dsdc_mrc_t()
+	o.annotation = unpack_dsdc_annotation_t(u)
+	o.refs = unpack_uhyper(u)
+	o.hits = u.unpack_array(lambda : unpack_uhyper(u))
+	o.check()
+	return o
+
+class dsdc_mrcs_t(object):
+	__slots__ = [ 'sizes', 'maxsz', 'sample_ppm', 'all', 'annotated' ]
+	def check(self):
+		pass
+		assert self.sizes is not None
+		assert self.maxsz is not None
+		assert self.sample_ppm is not None
+		assert self.all is not None
+		assert self.annotated is not None
+	def __eq__(self, other):
+		if not self.sizes == other.sizes: return 0
+		if not self.maxsz == other.maxsz: return 0
+		if not self.sample_ppm == other.sample_ppm: return 0
+		if not self.all == other.all: return 0
+		if not self.annotated == other.annotated: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_mrcs_t(p, o):
+	o.check()
+	p.pack_array(o.sizes, lambda x: pack_uhyper(p, x))
+	pack_uhyper(p, o.maxsz)
+	pack_uint(p, o.sample_ppm)
+	pack_dsdc_mrc_t(p, o.all)
+	p.pack_array(o.annotated, lambda x: pack_dsdc_mrc_t(p, x))
+def unpack_dsdc_mrcs_t(u):
+	o = dsdc_mrcs_t()
+	o.sizes = u.unpack_array(lambda : unpack_uhyper(u))
+	o.maxsz = unpack_uhyper(u)
+	o.sample_ppm = unpack_uint(u)
+	o.all = unpack_dsdc_mrc_t(u)
+	o.annotated = u.unpack_array(lambda : unpack_dsdc_mrc_t(u))
+	o.check()
+	return o
+
+class dsdc_get_mrc_arg_t(object):
+	__slots__ = [ 'n_points', 'max_bytes', 'reset' ]
+	def check(self):
+		pass
+		assert self.n_points is not None
+		assert self.max_bytes is not None
+		assert self.reset is not None
+	def __eq__(self, other):
+		if not self.n_points == other.n_points: return 0
+		if not self.max_bytes == other.max_bytes: return 0
+		if not self.reset == other.reset: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get_mrc_arg_t(p, o):
+	o.check()
+	pack_uint(p, o.n_points)
+	pack_uhyper(p, o.max_bytes)
+	pack_bool(p, o.reset)
+def unpack_dsdc_get_mrc_arg_t(u):
+	o = dsdc_get_mrc_arg_t()
+	o.n_points = unpack_uint(u)
+	o.max_bytes = unpack_uhyper(u)
+	o.reset = unpack_bool(u)
+	o.check()
+	return o
+
+class dsdc_get_mrc_res_t(object):
+	__slots__ = [ 'status', 'mrc' ]
+	def check(self):
+		pass
+		if self.status == DSDC_OK:
+			assert self.mrc is not None
+	def __eq__(self, other):
+		if not self.status == other.status: return 0
+		if self.status == DSDC_OK:
+			if not self.mrc == other.mrc: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get_mrc_res_t(p, o):
+	o.check()
+	pack_dsdc_res_t(p, o.status)
+	if o.status == DSDC_OK:
+		pack_dsdc_mrcs_t(p, o.mrc)
+def unpack_dsdc_get_mrc_res_t(u):
+	o = dsdc_get_mrc_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	if o.status == DSDC_OK:
+		o.mrc = unpack_dsdc_mrcs_t(u)
+	o.check()
+	return o
+
+class dsdc_profile_bin_t(object):
+	__slots__ = [ 'n_objs', 'bytes', 'raw_bytes' ]
+	def check(self):
+		pass
+		assert self.n_objs is not None
+		assert self.bytes is not None
+		assert self.raw_bytes is not None
+	def __eq__(self, other):
+		if not self.n_objs == other.n_objs: return 0
+		if not self.bytes == other.bytes: return 0
+		if not self.raw_bytes == other.raw_bytes: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_profile_bin_t(p, o):
+	o.check()
+	pack_uhyper(p, o.n_objs)
+	pack_uhyper(p, o.bytes)
+	pack_uhyper(p, o.raw_bytes)
+def unpack_dsdc_profile_bin_t(u):
+	o = dsdc_profile_bin_t()
+	o.n_objs = unpack_uhyper(u)
+	o.bytes = unpack_uhyper(u)
+	o.raw_bytes = unpack_uhyper(u)
+	o.check()
+	return o
+
+class dsdc_profile_annotated_t(object):
+	__slots__ = [ 'annotation', 'bin' ]
+	def check(self):
+		pass
+		assert self.annotation is not None
+		assert self.bin is not None
+	def __eq__(self, other):
+		if not self.annotation == other.annotation: return 0
+		if not self.bin == other.bin: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_profile_annotated_t(p, o):
+	o.check()
+	pack_dsdc_annotation_t(p, o.annotation)
+	pack_dsdc_profile_bin_t(p, o.bin)
+def unpack_dsdc_profile_annotated_t(u):
+	o = dsdc_profile_annotated_t()
+	o.annotation = unpack_dsdc_annotation_t(u)
+	o.bin = unpack_dsdc_profile_bin_t(u)
+	o.check()
+	return o
+
+class dsdc_profile_t(object):
+	__slots__ = [ 'walk_ms', 'all', 'annotated', 'by_size', 'by_age', 'n_hashed', 'lru_bytes', 'max_bytes', 'heap_bytes', 'heap_in_use', 'heap_free' ]
+	def check(self):
+		pass
+		assert self.walk_ms is not None
+		assert self.all is not None
+		assert self.annotated is not None
+		assert self.by_size is not None
+		assert self.by_age is not None
+		assert self.n_hashed is not None
+		assert self.lru_bytes is not None
+		assert self.max_bytes is not None
+		assert self.heap_bytes is not None
+		assert self.heap_in_use is not None
+		assert self.heap_free is not None
+	def __eq__(self, other):
+		if not self.walk_ms == other.walk_ms: return 0
+		if not self.all == other.all: return 0
+		if not self.annotated == other.annotated: return 0
+		if not self.by_size == other.by_size: return 0
+		if not self.by_age == other.by_age: return 0
+		if not self.n_hashed == other.n_hashed: return 0
+		if not self.lru_bytes == other.lru_bytes: return 0
+		if not self.max_bytes == other.max_bytes: return 0
+		if not self.heap_bytes == other.heap_bytes: return 0
+		if not self.heap_in_use == other.heap_in_use: return 0
+		if not self.heap_free == other.heap_free: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_profile_t(p, o):
+	o.check()
+	pack_uhyper(p, o.walk_ms)
+	pack_dsdc_profile_bin_t(p, o.all)
+	p.pack_array(o.annotated, lambda x: pack_dsdc_profile_annotated_t(p, x))
+	p.pack_array(o.by_size, lambda x: pack_dsdc_profile_bin_t(p, x))
+	p.pack_array(o.by_age, lambda x: pack_dsdc_profile_bin_t(p, x))
+	pack_uhyper(p, o.n_hashed)
+	pack_uhyper(p, o.lru_bytes)
+	pack_uhyper(p, o.max_bytes)
+	pack_uhyper(p, o.heap_bytes)
+	pack_uhyper(p, o.heap_in_use)
+	pack_uhyper(p, o.heap_free)
+def unpack_dsdc_profile_t(u):
+	o = dsdc_profile_t()
+	o.walk_ms = unpack_uhyper(u)
+	o.all = unpack_dsdc_profile_bin_t(u)
+	o.annotated = u.unpack_array(lambda : unpack_dsdc_profile_annotated_t(u))
+	o.by_size = u.unpack_array(lambda : unpack_dsdc_profile_bin_t(u))
+	o.by_age = u.unpack_array(lambda : unpack_dsdc_profile_bin_t(u))
+	o.n_hashed = unpack_uhyper(u)
+	o.lru_bytes = unpack_uhyper(u)
+	o.max_bytes = unpack_uhyper(u)
+	o.heap_bytes = unpack_uhyper(u)
+	o.heap_in_use = unpack_uhyper(u)
+	o.heap_free = unpack_uhyper(u)
+	o.check()
+	return o
+
+class dsdc_get_profile_res_t(object):
+	__slots__ = [ 'status', 'profile' ]
+	def check(self):
+		pass
+		if self.status == DSDC_OK:
+			assert self.profile is not None
+	def __eq__(self, other):
+		if not self.status == other.status: return 0
+		if self.status == DSDC_OK:
+			if not self.profile == other.profile: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get_profile_res_t(p, o):
+	o.check()
+	pack_dsdc_res_t(p, o.status)
+	if o.status == DSDC_OK:
+		pack_dsdc_profile_t(p, o.profile)
+def unpack_dsdc_get_profile_res_t(u):
+	o = dsdc_get_profile_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	if o.status == DSDC_OK:
+		o.profile = unpack_dsdc_profile_t(u)
+	o.check()
+	return o
+
+class dsdc_loop_slice_t(object):
+	__slots__ = [ 'what', 'proc', 'run_us', 'when_us' ]
+	def check(self):
+		pass
+		assert self.what is not None
+		assert self.proc is not None
+		assert self.run_us is not None
+		assert self.when_us is not None
+	def __eq__(self, other):
+		if not self.what == other.what: return 0
+		if not self.proc == other.proc: return 0
+		if not self.run_us == other.run_us: return 0
+		if not self.when_us == other.when_us: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_loop_slice_t(p, o):
+	o.check()
+	p.pack_string(o.what)
+	pack_uint(p, o.proc)
+	pack_uint(p, o.run_us)
+	pack_uhyper(p, o.when_us)
+def unpack_dsdc_loop_slice_t(u):
+	o = dsdc_loop_slice_t()
+	o.what = u.unpack_string()
+	o.proc = unpack_uint(u)
+	o.run_us = unpack_uint(u)
+	o.when_us = unpack_uhyper(u)
+	o.check()
+	return o
+
+class dsdc_loop_stats_t(object):
+	__slots__ = [ 'lag', 'run', 'busy_permille', 'window_ms', 'n_slow', 'slowest' ]
+	def check(self):
+		pass
+		assert self.lag is not None
+		assert self.run is not None
+		assert self.busy_permille is not None
+		assert self.window_ms is not None
+		assert self.n_slow is not None
+		assert self.slowest is not None
+	def __eq__(self, other):
+		if not self.lag == other.lag: return 0
+		if not self.run == other.run: return 0
+		if not self.busy_permille == other.busy_permille: return 0
+		if not self.window_ms == other.window_ms: return 0
+		if not self.n_slow == other.n_slow: return 0
+		if not self.slowest == other.slowest: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_loop_stats_t(p, o):
+	o.check()
+	pack_dsdc_histogram2_t(p, o.lag)
+	pack_dsdc_histogram2_t(p, o.run)
+	pack_uint(p, o.busy_permille)
+	pack_uhyper(p, o.window_ms)
+	pack_uhyper(p, o.n_slow)
+	p.pack_array(o.slowest, lambda x: pack_dsdc_loop_slice_t(p, x))
+def unpack_dsdc_loop_stats_t(u):
+	o = dsdc_loop_stats_t()
+	o.lag = unpack_dsdc_histogram2_t(u)
+	o.run = unpack_dsdc_histogram2_t(u)
+	o.busy_permille = unpack_uint(u)
+	o.window_ms = unpack_uhyper(u)
+	o.n_slow = unpack_uhyper(u)
+	o.slowest = u.unpack_array(lambda : unpack_dsdc_loop_slice_t(u))
+	o.check()
+	return o
+
+class dsdc_get_loop_stats_arg_t(object):
+	__slots__ = [ 'n_buckets', 'reset' ]
+	def check(self):
+		pass
+		assert self.n_buckets is not None
+		assert self.reset is not None
+	def __eq__(self, other):
+		if not self.n_buckets == other.n_buckets: return 0
+		if not self.reset == other.reset: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get_loop_stats_arg_t(p, o):
+	o.check()
+	pack_uint(p, o.n_buckets)
+	pack_bool(p, o.reset)
+def unpack_dsdc_get_loop_stats_arg_t(u):
+	o = dsdc_get_loop_stats_arg_t()
+	o.n_buckets = unpack_uint(u)
+	o.reset = unpack_bool(u)
+	o.check()
+	return o
+
+class dsdc_get_loop_stats_res_t(object):
+	__slots__ = [ 'status', 'stats' ]
+	def check(self):
+		pass
+		if self.status == DSDC_OK:
+			assert self.stats is not None
+	def __eq__(self, other):
+		if not self.status == other.status: return 0
+		if self.status == DSDC_OK:
+			if not self.stats == other.stats: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get_loop_stats_res_t(p, o):
+	o.check()
+	pack_dsdc_res_t(p, o.status)
+	if o.status == DSDC_OK:
+		pack_dsdc_loop_stats_t(p, o.stats)
+def unpack_dsdc_get_loop_stats_res_t(u):
+	o = dsdc_get_loop_stats_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	if o.status == DSDC_OK:
+		o.stats = unpack_dsdc_loop_stats_t(u)
+	o.check()
+	return o
+
+class dsdc_req_t(object):
+	__slots__ = [ 'key', 'time_to_expire' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.time_to_expire is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.time_to_expire == other.time_to_expire: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_req_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_int(p, o.time_to_expire)
+def unpack_dsdc_req_t(u):
+	o = dsdc_req_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.time_to_expire = unpack_int(u)
+	o.check()
+	return o
+
+def pack_dsdc_custom_t(p, o):
+	p.pack_opaque(o)
+def unpack_dsdc_custom_t(u):
+	return u.unpack_opaque()
+
+class dsdc_key_template_t(object):
+	__slots__ = [ 'id', 'pid', 'port', 'hostname' ]
+	def check(self):
+		pass
+		assert self.id is not None
+		assert self.pid is not None
+		assert self.port is not None
+		assert self.hostname is not None
+	def __eq__(self, other):
+		if not self.id == other.id: return 0
+		if not self.pid == other.pid: return 0
+		if not self.port == other.port: return 0
+		if not self.hostname == other.hostname: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_key_template_t(p, o):
+	o.check()
+	pack_uint(p, o.id)
+	pack_uint(p, o.pid)
+	pack_uint(p, o.port)
+	p.pack_string(o.hostname)
+def unpack_dsdc_key_template_t(u):
+	o = dsdc_key_template_t()
+	o.id = unpack_uint(u)
+	o.pid = unpack_uint(u)
+	o.port = unpack_uint(u)
+	o.hostname = u.unpack_string()
+	o.check()
+	return o
+
+def pack_dsdc_obj_t(p, o):
+	p.pack_opaque(o)
+def unpack_dsdc_obj_t(u):
+	return u.unpack_opaque()
+
+class dsdc_put_arg_t(object):
+	__slots__ = [ 'key', 'obj' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.obj is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.obj == other.obj: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_put_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_dsdc_obj_t(p, o.obj)
+def unpack_dsdc_put_arg_t(u):
+	o = dsdc_put_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.obj = unpack_dsdc_obj_t(u)
+	o.check()
+	return o
+
+class dsdc_get_res_t(object):
+	__slots__ = [ 'status', 'obj', 'err' ]
+	def check(self):
+		pass
+		if self.status == DSDC_OK:
+			assert self.obj is not None
+		elif self.status == DSDC_RPC_ERROR:
+			assert self.err is not None
+	def __eq__(self, other):
+		if not self.status == other.status: return 0
+		if self.status == DSDC_OK:
+			if not self.obj == other.obj: return 0
+		elif self.status == DSDC_RPC_ERROR:
+			if not self.err == other.err: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get_res_t(p, o):
+	o.check()
+	pack_dsdc_res_t(p, o.status)
+	if o.status == DSDC_OK:
+		pack_dsdc_obj_t(p, o.obj)
+	elif o.status == DSDC_RPC_ERROR:
+		pack_uint(p, o.err)
+def unpack_dsdc_get_res_t(u):
+	o = dsdc_get_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	if o.status == DSDC_OK:
+		o.obj = unpack_dsdc_obj_t(u)
+	elif o.status == DSDC_RPC_ERROR:
+		o.err = unpack_uint(u)
+	o.check()
+	return o
+
+class dsdc_mget_1res_t(object):
+	__slots__ = [ 'key', 'res' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.res is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.res == other.res: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_mget_1res_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_dsdc_get_res_t(p, o.res)
+def unpack_dsdc_mget_1res_t(u):
+	o = dsdc_mget_1res_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.res = unpack_dsdc_get_res_t(u)
+	o.check()
+	return o
+
+def pack_dsdc_mget_res_t(p, o):
+	p.pack_array(o, lambda x: pack_dsdc_mget_1res_t(p, x))
+def unpack_dsdc_mget_res_t(u):
+	return u.unpack_array(lambda : unpack_dsdc_mget_1res_t(u))
+
+def pack_dsdc_mget_arg_t(p, o):
+	p.pack_array(o, lambda x: pack_dsdc_key_t(p, x))
+def unpack_dsdc_mget_arg_t(u):
+	return u.unpack_array(lambda : unpack_dsdc_key_t(u))
+
+def pack_dsdc_mget2_arg_t(p, o):
+	p.pack_array(o, lambda x: pack_dsdc_req_t(p, x))
+def unpack_dsdc_mget2_arg_t(u):
+	return u.unpack_array(lambda : unpack_dsdc_req_t(u))
+
+def pack_dsdc_get_arg_t(p, o):
+	pack_dsdc_key_t(p, o)
+def unpack_dsdc_get_arg_t(u):
+	return unpack_dsdc_key_t(u)
+
+class dsdc_get3_arg_t(object):
+	__slots__ = [ 'key', 'time_to_expire', 'annotation' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.time_to_expire is not None
+		assert self.annotation is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.time_to_expire == other.time_to_expire: return 0
+		if not self.annotation == other.annotation: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get3_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_int(p, o.time_to_expire)
+	pack_dsdc_annotation_t(p, o.annotation)
+def unpack_dsdc_get3_arg_t(u):
+	o = dsdc_get3_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.time_to_expire = unpack_int(u)
+	o.annotation = unpack_dsdc_annotation_t(u)
+	o.check()
+	return o
+
+def pack_dsdc_mget3_arg_t(p, o):
+	p.pack_array(o, lambda x: pack_dsdc_get3_arg_t(p, x))
+def unpack_dsdc_mget3_arg_t(u):
+	return u.unpack_array(lambda : unpack_dsdc_get3_arg_t(u))
+
+class dsdc_put3_arg_t(object):
+	__slots__ = [ 'key', 'obj', 'annotation' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.obj is not None
+		assert self.annotation is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.obj == other.obj: return 0
+		if not self.annotation == other.annotation: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_put3_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_dsdc_obj_t(p, o.obj)
+	pack_dsdc_annotation_t(p, o.annotation)
+def unpack_dsdc_put3_arg_t(u):
+	o = dsdc_put3_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.obj = unpack_dsdc_obj_t(u)
+	o.annotation = unpack_dsdc_annotation_t(u)
+	o.check()
+	return o
+
+def pack_dsdc_cksum_t(p, o):
+	pack_dsdc_key_t(p, o)
+def unpack_dsdc_cksum_t(u):
+	return unpack_dsdc_key_t(u)
+
+class dsdc_put4_arg_t(object):
+	__slots__ = [ 'key', 'obj', 'annotation', 'checksum' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.obj is not None
+		assert self.annotation is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.obj == other.obj: return 0
+		if not self.annotation == other.annotation: return 0
+		if not self.checksum == other.checksum: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_put4_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_dsdc_obj_t(p, o.obj)
+	pack_dsdc_annotation_t(p, o.annotation)
+	pack_ptr(p, o.checksum, lambda x: pack_dsdc_cksum_t(p, x))
+def unpack_dsdc_put4_arg_t(u):
+	o = dsdc_put4_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.obj = unpack_dsdc_obj_t(u)
+	o.annotation = unpack_dsdc_annotation_t(u)
+	o.checksum = unpack_ptr(u, lambda : unpack_dsdc_cksum_t(u))
+	o.check()
+	return o
+
+class dsdc_remove3_arg_t(object):
+	__slots__ = [ 'key', 'annotation' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.annotation is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.annotation == other.annotation: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_remove3_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_dsdc_annotation_t(p, o.annotation)
+def unpack_dsdc_remove3_arg_t(u):
+	o = dsdc_remove3_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.annotation = unpack_dsdc_annotation_t(u)
+	o.check()
+	return o
+
+def pack_dsdc_deadline_t(p, o):
+	pack_uhyper(p, o)
+def unpack_dsdc_deadline_t(u):
+	return unpack_uhyper(u)
+
+class dsdc_get4_arg_t(object):
+	__slots__ = [ 'key', 'time_to_expire', 'annotation', 'deadline' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.time_to_expire is not None
+		assert self.annotation is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.time_to_expire == other.time_to_expire: return 0
+		if not self.annotation == other.annotation: return 0
+		if not self.deadline == other.deadline: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get4_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_int(p, o.time_to_expire)
+	pack_dsdc_annotation_t(p, o.annotation)
+	pack_ptr(p, o.deadline, lambda x: pack_dsdc_deadline_t(p, x))
+def unpack_dsdc_get4_arg_t(u):
+	o = dsdc_get4_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.time_to_expire = unpack_int(u)
+	o.annotation = unpack_dsdc_annotation_t(u)
+	o.deadline = unpack_ptr(u, lambda : unpack_dsdc_deadline_t(u))
+	o.check()
+	return o
+
+class dsdc_mget4_arg_t(object):
+	__slots__ = [ 'keys', 'deadline' ]
+	def check(self):
+		pass
+		assert self.keys is not None
+	def __eq__(self, other):
+		if not self.keys == other.keys: return 0
+		if not self.deadline == other.deadline: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_mget4_arg_t(p, o):
+	o.check()
+	p.pack_array(o.keys, lambda x: pack_dsdc_get3_arg_t(p, x))
+	pack_ptr(p, o.deadline, lambda x: pack_dsdc_deadline_t(p, x))
+def unpack_dsdc_mget4_arg_t(u):
+	o = dsdc_mget4_arg_t()
+	o.keys = u.unpack_array(lambda : unpack_dsdc_get3_arg_t(u))
+	o.deadline = unpack_ptr(u, lambda : unpack_dsdc_deadline_t(u))
+	o.check()
+	return o
+
+class dsdc_put5_arg_t(object):
+	__slots__ = [ 'key', 'obj', 'annotation', 'checksum', 'deadline' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.obj is not None
+		assert self.annotation is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.obj == other.obj: return 0
+		if not self.annotation == other.annotation: return 0
+		if not self.checksum == other.checksum: return 0
+		if not self.deadline == other.deadline: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_put5_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_dsdc_obj_t(p, o.obj)
+	pack_dsdc_annotation_t(p, o.annotation)
+	pack_ptr(p, o.checksum, lambda x: pack_dsdc_cksum_t(p, x))
+	pack_ptr(p, o.deadline, lambda x: pack_dsdc_deadline_t(p, x))
+def unpack_dsdc_put5_arg_t(u):
+	o = dsdc_put5_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.obj = unpack_dsdc_obj_t(u)
+	o.annotation = unpack_dsdc_annotation_t(u)
+	o.checksum = unpack_ptr(u, lambda : unpack_dsdc_cksum_t(u))
+	o.deadline = unpack_ptr(u, lambda : unpack_dsdc_deadline_t(u))
+	o.check()
+	return o
+
+class dsdc_put6_arg_t(object):
+	__slots__ = [ 'key', 'obj', 'annotation', 'checksum', 'deadline', 'fence' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.obj is not None
+		assert self.annotation is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.obj == other.obj: return 0
+		if not self.annotation == other.annotation: return 0
+		if not self.checksum == other.checksum: return 0
+		if not self.deadline == other.deadline: return 0
+		if not self.fence == other.fence: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_put6_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_dsdc_obj_t(p, o.obj)
+	pack_dsdc_annotation_t(p, o.annotation)
+	pack_ptr(p, o.checksum, lambda x: pack_dsdc_cksum_t(p, x))
+	pack_ptr(p, o.deadline, lambda x: pack_dsdc_deadline_t(p, x))
+	pack_ptr(p, o.fence, lambda x: pack_uhyper(p, x))
+def unpack_dsdc_put6_arg_t(u):
+	o = dsdc_put6_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.obj = unpack_dsdc_obj_t(u)
+	o.annotation = unpack_dsdc_annotation_t(u)
+	o.checksum = unpack_ptr(u, lambda : unpack_dsdc_cksum_t(u))
+	o.deadline = unpack_ptr(u, lambda : unpack_dsdc_deadline_t(u))
+	o.fence = unpack_ptr(u, lambda : unpack_uhyper(u))
+	o.check()
+	return o
+
+class dsdc_trace_t(object):
+	__slots__ = [ 'trace_id', 'parent_id', 'sampled' ]
+	def check(self):
+		pass
+		assert self.trace_id is not None
+		assert self.parent_id is not None
+		assert self.sampled is not None
+	def __eq__(self, other):
+		if not self.trace_id == other.trace_id: return 0
+		if not self.parent_id == other.parent_id: return 0
+		if not self.sampled == other.sampled: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_trace_t(p, o):
+	o.check()
+	pack_uhyper(p, o.trace_id)
+	pack_uhyper(p, o.parent_id)
+	pack_bool(p, o.sampled)
+def unpack_dsdc_trace_t(u):
+	o = dsdc_trace_t()
+	o.trace_id = unpack_uhyper(u)
+	o.parent_id = unpack_uhyper(u)
+	o.sampled = unpack_bool(u)
+	o.check()
+	return o
+
+class dsdc_get5_arg_t(object):
+	__slots__ = [ 'get', 'trace' ]
+	def check(self):
+		pass
+		assert self.get is not None
+	def __eq__(self, other):
+		if not self.get == other.get: return 0
+		if not self.trace == other.trace: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get5_arg_t(p, o):
+	o.check()
+	pack_dsdc_get4_arg_t(p, o.get)
+	pack_ptr(p, o.trace, lambda x: pack_dsdc_trace_t(p, x))
+def unpack_dsdc_get5_arg_t(u):
+	o = dsdc_get5_arg_t()
+	o.get = unpack_dsdc_get4_arg_t(u)
+	o.trace = unpack_ptr(u, lambda : unpack_dsdc_trace_t(u))
+	o.check()
+	return o
+
+class dsdc_put7_arg_t(object):
+	__slots__ = [ 'put', 'trace' ]
+	def check(self):
+		pass
+		assert self.put is not None
+	def __eq__(self, other):
+		if not self.put == other.put: return 0
+		if not self.trace == other.trace: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_put7_arg_t(p, o):
+	o.check()
+	pack_dsdc_put6_arg_t(p, o.put)
+	pack_ptr(p, o.trace, lambda x: pack_dsdc_trace_t(p, x))
+def unpack_dsdc_put7_arg_t(u):
+	o = dsdc_put7_arg_t()
+	o.put = unpack_dsdc_put6_arg_t(u)
+	o.trace = unpack_ptr(u, lambda : unpack_dsdc_trace_t(u))
+	o.check()
+	return o
+
+def pack_dsdc_codec_t(p, o):
+	p.pack_uint(o)
+def unpack_dsdc_codec_t(u):
+	return u.unpack_uint()
+
+DSDC_CODEC_NONE = 0
+DSDC_CODEC_SNAPPY = 1
+
+class dsdc_putz_arg_t(object):
+	__slots__ = [ 'put', 'codec', 'raw_len' ]
+	def check(self):
+		pass
+		assert self.put is not None
+		assert self.codec is not None
+		assert self.raw_len is not None
+	def __eq__(self, other):
+		if not self.put == other.put: return 0
+		if not self.codec == other.codec: return 0
+		if not self.raw_len == other.raw_len: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_putz_arg_t(p, o):
+	o.check()
+	pack_dsdc_put7_arg_t(p, o.put)
+	pack_dsdc_codec_t(p, o.codec)
+	pack_uint(p, o.raw_len)
+def unpack_dsdc_putz_arg_t(u):
+	o = dsdc_putz_arg_t()
+	o.put = unpack_dsdc_put7_arg_t(u)
+	o.codec = unpack_dsdc_codec_t(u)
+	o.raw_len = unpack_uint(u)
+	o.check()
+	return o
+
+class dsdc_mput_z_t(object):
+	__slots__ = [ 'put', 'codec', 'raw_len' ]
+	def check(self):
+		pass
+		assert self.put is not None
+		assert self.codec is not None
+		assert self.raw_len is not None
+	def __eq__(self, other):
+		if not self.put == other.put: return 0
+		if not self.codec == other.codec: return 0
+		if not self.raw_len == other.raw_len: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_mput_z_t(p, o):
+	o.check()
+	pack_dsdc_put4_arg_t(p, o.put)
+	pack_dsdc_codec_t(p, o.codec)
+	pack_uint(p, o.raw_len)
+def unpack_dsdc_mput_z_t(u):
+	o = dsdc_mput_z_t()
+	o.put = unpack_dsdc_put4_arg_t(u)
+	o.codec = unpack_dsdc_codec_t(u)
+	o.raw_len = unpack_uint(u)
+	o.check()
+	return o
+
+class dsdc_span_t(object):
+	__slots__ = [ 'trace_id', 'span_id', 'parent_id', 'proc', 'start_us', 'total_us', 'upstream_us' ]
+	def check(self):
+		pass
+		assert self.trace_id is not None
+		assert self.span_id is not None
+		assert self.parent_id is not None
+		assert self.proc is not None
+		assert self.start_us is not None
+		assert self.total_us is not None
+		assert self.upstream_us is not None
+	def __eq__(self, other):
+		if not self.trace_id == other.trace_id: return 0
+		if not self.span_id == other.span_id: return 0
+		if not self.parent_id == other.parent_id: return 0
+		if not self.proc == other.proc: return 0
+		if not self.start_us == other.start_us: return 0
+		if not self.total_us == other.total_us: return 0
+		if not self.upstream_us == other.upstream_us: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_span_t(p, o):
+	o.check()
+	pack_uhyper(p, o.trace_id)
+	pack_uhyper(p, o.span_id)
+	pack_uhyper(p, o.parent_id)
+	pack_uint(p, o.proc)
+	pack_uhyper(p, o.start_us)
+	pack_uint(p, o.total_us)
+	pack_uint(p, o.upstream_us)
+def unpack_dsdc_span_t(u):
+	o = dsdc_span_t()
+	o.trace_id = unpack_uhyper(u)
+	o.span_id = unpack_uhyper(u)
+	o.parent_id = unpack_uhyper(u)
+	o.proc = unpack_uint(u)
+	o.start_us = unpack_uhyper(u)
+	o.total_us = unpack_uint(u)
+	o.upstream_us = unpack_uint(u)
+	o.check()
+	return o
+
+class dsdc_get_traces_arg_t(object):
+	__slots__ = [ 'trace_id', 'reset' ]
+	def check(self):
+		pass
+		assert self.trace_id is not None
+		assert self.reset is not None
+	def __eq__(self, other):
+		if not self.trace_id == other.trace_id: return 0
+		if not self.reset == other.reset: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get_traces_arg_t(p, o):
+	o.check()
+	pack_uhyper(p, o.trace_id)
+	pack_bool(p, o.reset)
+def unpack_dsdc_get_traces_arg_t(u):
+	o = dsdc_get_traces_arg_t()
+	o.trace_id = unpack_uhyper(u)
+	o.reset = unpack_bool(u)
+	o.check()
+	return o
+
+class dsdc_get_traces_res_t(object):
+	__slots__ = [ 'status', 'spans' ]
+	def check(self):
+		pass
+		if self.status == DSDC_OK:
+			assert self.spans is not None
+	def __eq__(self, other):
+		if not self.status == other.status: return 0
+		if self.status == DSDC_OK:
+			if not self.spans == other.spans: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_get_traces_res_t(p, o):
+	o.check()
+	pack_dsdc_res_t(p, o.status)
+	if o.status == DSDC_OK:
+		p.pack_array(o.spans, lambda x: pack_dsdc_span_t(p, x))
+def unpack_dsdc_get_traces_res_t(u):
+	o = dsdc_get_traces_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	if o.status == DSDC_OK:
+		o.spans = u.unpack_array(lambda : unpack_dsdc_span_t(u))
+	o.check()
+	return o
+
+def pack_dsdc_mput_op_type_t(p, o):
+	p.pack_uint(o)
+def unpack_dsdc_mput_op_type_t(u):
+	return u.unpack_uint()
+
+DSDC_MPUT_PUT = 0
+DSDC_MPUT_REMOVE = 1
+DSDC_MPUT_PUTZ = 2
+
+class dsdc_mput_op_t(object):
+	__slots__ = [ 'typ', 'put', 'remove', 'putz' ]
+	def check(self):
+		pass
+		if self.typ == DSDC_MPUT_PUT:
+			assert self.put is not None
+		elif self.typ == DSDC_MPUT_REMOVE:
+			assert self.remove is not None
+		elif self.typ == DSDC_MPUT_PUTZ:
+			assert self.putz is not None
+	def __eq__(self, other):
+		if not self.typ == other.typ: return 0
+		if self.typ == DSDC_MPUT_PUT:
+			if not self.put == other.put: return 0
+		elif self.typ == DSDC_MPUT_REMOVE:
+			if not self.remove == other.remove: return 0
+		elif self.typ == DSDC_MPUT_PUTZ:
+			if not self.putz == other.putz: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_mput_op_t(p, o):
+	o.check()
+	pack_dsdc_mput_op_type_t(p, o.typ)
+	if o.typ == DSDC_MPUT_PUT:
+		pack_dsdc_put4_arg_t(p, o.put)
+	elif o.typ == DSDC_MPUT_REMOVE:
+		pack_dsdc_remove3_arg_t(p, o.remove)
+	elif o.typ == DSDC_MPUT_PUTZ:
+		pack_dsdc_mput_z_t(p, o.putz)
+def unpack_dsdc_mput_op_t(u):
+	o = dsdc_mput_op_t()
+	o.typ = unpack_dsdc_mput_op_type_t(u)
+	if o.typ == DSDC_MPUT_PUT:
+		o.put = unpack_dsdc_put4_arg_t(u)
+	elif o.typ == DSDC_MPUT_REMOVE:
+		o.remove = unpack_dsdc_remove3_arg_t(u)
+	elif o.typ == DSDC_MPUT_PUTZ:
+		o.putz = unpack_dsdc_mput_z_t(u)
+	o.check()
+	return o
+
+def pack_dsdc_mput_arg_t(p, o):
+	p.pack_array(o, lambda x: pack_dsdc_mput_op_t(p, x))
+def unpack_dsdc_mput_arg_t(u):
+	return u.unpack_array(lambda : unpack_dsdc_mput_op_t(u))
+
+def pack_dsdc_mput_res_t(p, o):
+	p.pack_array(o, lambda x: pack_dsdc_res_t(p, x))
+def unpack_dsdc_mput_res_t(u):
+	return u.unpack_array(lambda : unpack_dsdc_res_t(u))
+
+def pack_dsdc_mremove_arg_t(p, o):
+	p.pack_array(o, lambda x: pack_dsdc_remove3_arg_t(p, x))
+def unpack_dsdc_mremove_arg_t(u):
+	return u.unpack_array(lambda : unpack_dsdc_remove3_arg_t(u))
+
+def pack_dsdc_atomic_op_type_t(p, o):
+	p.pack_uint(o)
+def unpack_dsdc_atomic_op_type_t(u):
+	return u.unpack_uint()
+
+DSDC_ATOMIC_READ = 0
+DSDC_ATOMIC_CAS = 1
+DSDC_ATOMIC_INCR = 2
+DSDC_ATOMIC_APPEND = 3
+
+def pack_dsdc_cas_type_t(p, o):
+	p.pack_uint(o)
+def unpack_dsdc_cas_type_t(u):
+	return u.unpack_uint()
+
+DSDC_CAS_CHECKSUM = 0
+DSDC_CAS_VERSION = 1
+
+class dsdc_cas_expect_t(object):
+	__slots__ = [ 'typ', 'checksum', 'version' ]
+	def check(self):
+		pass
+		if self.typ == DSDC_CAS_CHECKSUM:
+			assert self.checksum is not None
+		elif self.typ == DSDC_CAS_VERSION:
+			assert self.version is not None
+	def __eq__(self, other):
+		if not self.typ == other.typ: return 0
+		if self.typ == DSDC_CAS_CHECKSUM:
+			if not self.checksum == other.checksum: return 0
+		elif self.typ == DSDC_CAS_VERSION:
+			if not self.version == other.version: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_cas_expect_t(p, o):
+	o.check()
+	pack_dsdc_cas_type_t(p, o.typ)
+	if o.typ == DSDC_CAS_CHECKSUM:
+		pack_dsdc_cksum_t(p, o.checksum)
+	elif o.typ == DSDC_CAS_VERSION:
+		pack_uhyper(p, o.version)
+def unpack_dsdc_cas_expect_t(u):
+	o = dsdc_cas_expect_t()
+	o.typ = unpack_dsdc_cas_type_t(u)
+	if o.typ == DSDC_CAS_CHECKSUM:
+		o.checksum = unpack_dsdc_cksum_t(u)
+	elif o.typ == DSDC_CAS_VERSION:
+		o.version = unpack_uhyper(u)
+	o.check()
+	return o
+
+class dsdc_cas_arg_t(object):
+	__slots__ = [ 'expect', 'obj' ]
+	def check(self):
+		pass
+		assert self.expect is not None
+		assert self.obj is not None
+	def __eq__(self, other):
+		if not self.expect == other.expect: return 0
+		if not self.obj == other.obj: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_cas_arg_t(p, o):
+	o.check()
+	pack_dsdc_cas_expect_t(p, o.expect)
+	pack_dsdc_obj_t(p, o.obj)
+def unpack_dsdc_cas_arg_t(u):
+	o = dsdc_cas_arg_t()
+	o.expect = unpack_dsdc_cas_expect_t(u)
+	o.obj = unpack_dsdc_obj_t(u)
+	o.check()
+	return o
+
+class dsdc_incr_arg_t(object):
+	__slots__ = [ 'delta', 'initial' ]
+	def check(self):
+		pass
+		assert self.delta is not None
+	def __eq__(self, other):
+		if not self.delta == other.delta: return 0
+		if not self.initial == other.initial: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_incr_arg_t(p, o):
+	o.check()
+	pack_hyper(p, o.delta)
+	pack_ptr(p, o.initial, lambda x: pack_hyper(p, x))
+def unpack_dsdc_incr_arg_t(u):
+	o = dsdc_incr_arg_t()
+	o.delta = unpack_hyper(u)
+	o.initial = unpack_ptr(u, lambda : unpack_hyper(u))
+	o.check()
+	return o
+
+class dsdc_atomic_op_t(object):
+	__slots__ = [ 'typ', 'cas', 'incr', 'data' ]
+	def check(self):
+		pass
+		if self.typ == DSDC_ATOMIC_CAS:
+			assert self.cas is not None
+		elif self.typ == DSDC_ATOMIC_INCR:
+			assert self.incr is not None
+		elif self.typ == DSDC_ATOMIC_APPEND:
+			assert self.data is not None
+	def __eq__(self, other):
+		if not self.typ == other.typ: return 0
+		if self.typ == DSDC_ATOMIC_CAS:
+			if not self.cas == other.cas: return 0
+		elif self.typ == DSDC_ATOMIC_INCR:
+			if not self.incr == other.incr: return 0
+		elif self.typ == DSDC_ATOMIC_APPEND:
+			if not self.data == other.data: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_atomic_op_t(p, o):
+	o.check()
+	pack_dsdc_atomic_op_type_t(p, o.typ)
+	if o.typ == DSDC_ATOMIC_CAS:
+		pack_dsdc_cas_arg_t(p, o.cas)
+	elif o.typ == DSDC_ATOMIC_INCR:
+		pack_dsdc_incr_arg_t(p, o.incr)
+	elif o.typ == DSDC_ATOMIC_APPEND:
+		pack_dsdc_obj_t(p, o.data)
+def unpack_dsdc_atomic_op_t(u):
+	o = dsdc_atomic_op_t()
+	o.typ = unpack_dsdc_atomic_op_type_t(u)
+	if o.typ == DSDC_ATOMIC_CAS:
+		o.cas = unpack_dsdc_cas_arg_t(u)
+	elif o.typ == DSDC_ATOMIC_INCR:
+		o.incr = unpack_dsdc_incr_arg_t(u)
+	elif o.typ == DSDC_ATOMIC_APPEND:
+		o.data = unpack_dsdc_obj_t(u)
+	o.check()
+	return o
+
+class dsdc_atomic_arg_t(object):
+	__slots__ = [ 'key', 'op', 'deadline' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.op is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.op == other.op: return 0
+		if not self.deadline == other.deadline: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_atomic_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_dsdc_atomic_op_t(p, o.op)
+	pack_ptr(p, o.deadline, lambda x: pack_dsdc_deadline_t(p, x))
+def unpack_dsdc_atomic_arg_t(u):
+	o = dsdc_atomic_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.op = unpack_dsdc_atomic_op_t(u)
+	o.deadline = unpack_ptr(u, lambda : unpack_dsdc_deadline_t(u))
+	o.check()
+	return o
+
+class dsdc_atomic_res_t(object):
+	__slots__ = [ 'status', 'version', 'counter', 'obj' ]
+	def check(self):
+		pass
+		assert self.status is not None
+		assert self.version is not None
+		assert self.counter is not None
+	def __eq__(self, other):
+		if not self.status == other.status: return 0
+		if not self.version == other.version: return 0
+		if not self.counter == other.counter: return 0
+		if not self.obj == other.obj: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_atomic_res_t(p, o):
+	o.check()
+	pack_dsdc_res_t(p, o.status)
+	pack_uhyper(p, o.version)
+	pack_hyper(p, o.counter)
+	pack_ptr(p, o.obj, lambda x: pack_dsdc_obj_t(p, x))
+def unpack_dsdc_atomic_res_t(u):
+	o = dsdc_atomic_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	o.version = unpack_uhyper(u)
+	o.counter = unpack_hyper(u)
+	o.obj = unpack_ptr(u, lambda : unpack_dsdc_obj_t(u))
+	o.check()
+	return o
+
+class dsdc_chunk_manifest_t(object):
+	__slots__ = [ 'size', 'cksum', 'chunks' ]
+	def check(self):
+		pass
+		assert self.size is not None
+		assert self.cksum is not None
+		assert self.chunks is not None
+	def __eq__(self, other):
+		if not self.size == other.size: return 0
+		if not self.cksum == other.cksum: return 0
+		if not self.chunks == other.chunks: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_chunk_manifest_t(p, o):
+	o.check()
+	pack_uint(p, o.size)
+	pack_dsdc_cksum_t(p, o.cksum)
+	p.pack_array(o.chunks, lambda x: pack_dsdc_key_t(p, x))
+def unpack_dsdc_chunk_manifest_t(u):
+	o = dsdc_chunk_manifest_t()
+	o.size = unpack_uint(u)
+	o.cksum = unpack_dsdc_cksum_t(u)
+	o.chunks = u.unpack_array(lambda : unpack_dsdc_key_t(u))
+	o.check()
+	return o
+
+class dsdc_compression_res_t(object):
+	__slots__ = [ 'codecs', 'n_objs', 'n_compressed', 'stored_bytes', 'raw_bytes' ]
+	def check(self):
+		pass
+		assert self.codecs is not None
+		assert self.n_objs is not None
+		assert self.n_compressed is not None
+		assert self.stored_bytes is not None
+		assert self.raw_bytes is not None
+	def __eq__(self, other):
+		if not self.codecs == other.codecs: return 0
+		if not self.n_objs == other.n_objs: return 0
+		if not self.n_compressed == other.n_compressed: return 0
+		if not self.stored_bytes == other.stored_bytes: return 0
+		if not self.raw_bytes == other.raw_bytes: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_compression_res_t(p, o):
+	o.check()
+	pack_uint(p, o.codecs)
+	pack_uhyper(p, o.n_objs)
+	pack_uhyper(p, o.n_compressed)
+	pack_uhyper(p, o.stored_bytes)
+	pack_uhyper(p, o.raw_bytes)
+def unpack_dsdc_compression_res_t(u):
+	o = dsdc_compression_res_t()
+	o.codecs = unpack_uint(u)
+	o.n_objs = unpack_uhyper(u)
+	o.n_compressed = unpack_uhyper(u)
+	o.stored_bytes = unpack_uhyper(u)
+	o.raw_bytes = unpack_uhyper(u)
+	o.check()
+	return o
+
+class dsdcx_slave_t(object):
+	__slots__ = [ 'keys', 'hostname', 'port' ]
+	def check(self):
+		pass
+		assert self.keys is not None
+		assert self.hostname is not None
+		assert self.port is not None
+	def __eq__(self, other):
+		if not self.keys == other.keys: return 0
+		if not self.hostname == other.hostname: return 0
+		if not self.port == other.port: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdcx_slave_t(p, o):
+	o.check()
+	pack_dsdc_keyset_t(p, o.keys)
+	p.pack_string(o.hostname)
+	pack_int(p, o.port)
+def unpack_dsdcx_slave_t(u):
+	o = dsdcx_slave_t()
+	o.keys = unpack_dsdc_keyset_t(u)
+	o.hostname = u.unpack_string()
+	o.port = unpack_int(u)
+	o.check()
+	return o
+
+class dsdcx_state_t(object):
+	__slots__ = [ 'slaves', 'lock_server' ]
+	def check(self):
+		pass
+		assert self.slaves is not None
+	def __eq__(self, other):
+		if not self.slaves == other.slaves: return 0
+		if not self.lock_server == other.lock_server: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdcx_state_t(p, o):
+	o.check()
+	p.pack_array(o.slaves, lambda x: pack_dsdcx_slave_t(p, x))
+	pack_ptr(p, o.lock_server, lambda x: pack_dsdcx_slave_t(p, x))
+def unpack_dsdcx_state_t(u):
+	o = dsdcx_state_t()
+	o.slaves = u.unpack_array(lambda : unpack_dsdcx_slave_t(u))
+	o.lock_server = unpack_ptr(u, lambda : unpack_dsdcx_slave_t(u))
+	o.check()
+	return o
+
+class dsdcx_state2_t(object):
+	__slots__ = [ 'state', 'lock_servers' ]
+	def check(self):
+		pass
+		assert self.state is not None
+		assert self.lock_servers is not None
+	def __eq__(self, other):
+		if not self.state == other.state: return 0
+		if not self.lock_servers == other.lock_servers: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdcx_state2_t(p, o):
+	o.check()
+	pack_dsdcx_state_t(p, o.state)
+	p.pack_array(o.lock_servers, lambda x: pack_dsdcx_slave_t(p, x))
+def unpack_dsdcx_state2_t(u):
+	o = dsdcx_state2_t()
+	o.state = unpack_dsdcx_state_t(u)
+	o.lock_servers = u.unpack_array(lambda : unpack_dsdcx_slave_t(u))
+	o.check()
+	return o
+
+class dsdc_register_arg_t(object):
+	__slots__ = [ 'slave', 'primary', 'lock_server' ]
+	def check(self):
+		pass
+		assert self.slave is not None
+		assert self.primary is not None
+		assert self.lock_server is not None
+	def __eq__(self, other):
+		if not self.slave == other.slave: return 0
+		if not self.primary == other.primary: return 0
+		if not self.lock_server == other.lock_server: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_register_arg_t(p, o):
+	o.check()
+	pack_dsdcx_slave_t(p, o.slave)
+	pack_bool(p, o.primary)
+	pack_bool(p, o.lock_server)
+def unpack_dsdc_register_arg_t(u):
+	o = dsdc_register_arg_t()
+	o.slave = unpack_dsdcx_slave_t(u)
+	o.primary = unpack_bool(u)
+	o.lock_server = unpack_bool(u)
+	o.check()
+	return o
+
+class dsdc_getstate_res_t(object):
+	__slots__ = [ 'needupdate', 'state' ]
+	def check(self):
+		pass
+		assert self.needupdate is not None
+		if self.needupdate == true:
+			assert self.state is not None
+	def __eq__(self, other):
+		if not self.needupdate == other.needupdate: return 0
+		if self.needupdate == true:
+			if not self.state == other.state: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_getstate_res_t(p, o):
+	o.check()
+	pack_bool(p, o.needupdate)
+	if o.needupdate == true:
+		pack_dsdcx_state_t(p, o.state)
+def unpack_dsdc_getstate_res_t(u):
+	o = dsdc_getstate_res_t()
+	o.needupdate = unpack_bool(u)
+	if o.needupdate == true:
+		o.state = unpack_dsdcx_state_t(u)
+	o.check()
+	return o
+
+class dsdc_getstate2_res_t(object):
+	__slots__ = [ 'needupdate', 'state' ]
+	def check(self):
+		pass
+		assert self.needupdate is not None
+		if self.needupdate == true:
+			assert self.state is not None
+	def __eq__(self, other):
+		if not self.needupdate == other.needupdate: return 0
+		if self.needupdate == true:
+			if not self.state == other.state: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_getstate2_res_t(p, o):
+	o.check()
+	pack_bool(p, o.needupdate)
+	if o.needupdate == true:
+		pack_dsdcx_state2_t(p, o.state)
+def unpack_dsdc_getstate2_res_t(u):
+	o = dsdc_getstate2_res_t()
+	o.needupdate = unpack_bool(u)
+	if o.needupdate == true:
+		o.state = unpack_dsdcx_state2_t(u)
+	o.check()
+	return o
+
+class dsdc_lock_acquire_res_t(object):
+	__slots__ = [ 'status', 'lockid', 'err' ]
+	def check(self):
+		pass
+		if self.status == DSDC_OK:
+			assert self.lockid is not None
+		elif self.status == DSDC_RPC_ERROR:
+			assert self.err is not None
+	def __eq__(self, other):
+		if not self.status == other.status: return 0
+		if self.status == DSDC_OK:
+			if not self.lockid == other.lockid: return 0
+		elif self.status == DSDC_RPC_ERROR:
+			if not self.err == other.err: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_lock_acquire_res_t(p, o):
+	o.check()
+	pack_dsdc_res_t(p, o.status)
+	if o.status == DSDC_OK:
+		pack_uhyper(p, o.lockid)
+	elif o.status == DSDC_RPC_ERROR:
+		pack_uint(p, o.err)
+def unpack_dsdc_lock_acquire_res_t(u):
+	o = dsdc_lock_acquire_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	if o.status == DSDC_OK:
+		o.lockid = unpack_uhyper(u)
+	elif o.status == DSDC_RPC_ERROR:
+		o.err = unpack_uint(u)
+	o.check()
+	return o
+
+class dsdc_lock_acquire_arg_t(object):
+	__slots__ = [ 'key', 'writer', 'block', 'timeout' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.writer is not None
+		assert self.block is not None
+		assert self.timeout is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.writer == other.writer: return 0
+		if not self.block == other.block: return 0
+		if not self.timeout == other.timeout: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_lock_acquire_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_bool(p, o.writer)
+	pack_bool(p, o.block)
+	pack_uint(p, o.timeout)
+def unpack_dsdc_lock_acquire_arg_t(u):
+	o = dsdc_lock_acquire_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.writer = unpack_bool(u)
+	o.block = unpack_bool(u)
+	o.timeout = unpack_uint(u)
+	o.check()
+	return o
+
+class dsdc_lock_acquire2_arg_t(object):
+	__slots__ = [ 'key', 'writer', 'block', 'timeout', 'priority', 'ns' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.writer is not None
+		assert self.block is not None
+		assert self.timeout is not None
+		assert self.priority is not None
+		assert self.ns is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.writer == other.writer: return 0
+		if not self.block == other.block: return 0
+		if not self.timeout == other.timeout: return 0
+		if not self.priority == other.priority: return 0
+		if not self.ns == other.ns: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_lock_acquire2_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_bool(p, o.writer)
+	pack_bool(p, o.block)
+	pack_uint(p, o.timeout)
+	pack_uint(p, o.priority)
+	pack_uint(p, o.ns)
+def unpack_dsdc_lock_acquire2_arg_t(u):
+	o = dsdc_lock_acquire2_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.writer = unpack_bool(u)
+	o.block = unpack_bool(u)
+	o.timeout = unpack_uint(u)
+	o.priority = unpack_uint(u)
+	o.ns = unpack_uint(u)
+	o.check()
+	return o
+
+class dsdc_lock_release_arg_t(object):
+	__slots__ = [ 'key', 'lockid' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.lockid is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.lockid == other.lockid: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_lock_release_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_uhyper(p, o.lockid)
+def unpack_dsdc_lock_release_arg_t(u):
+	o = dsdc_lock_release_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.lockid = unpack_uhyper(u)
+	o.check()
+	return o
+
+class dsdc_lock_renew_arg_t(object):
+	__slots__ = [ 'key', 'lockid', 'timeout' ]
+	def check(self):
+		pass
+		assert self.key is not None
+		assert self.lockid is not None
+		assert self.timeout is not None
+	def __eq__(self, other):
+		if not self.key == other.key: return 0
+		if not self.lockid == other.lockid: return 0
+		if not self.timeout == other.timeout: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_lock_renew_arg_t(p, o):
+	o.check()
+	pack_dsdc_key_t(p, o.key)
+	pack_uhyper(p, o.lockid)
+	pack_uint(p, o.timeout)
+def unpack_dsdc_lock_renew_arg_t(u):
+	o = dsdc_lock_renew_arg_t()
+	o.key = unpack_dsdc_key_t(u)
+	o.lockid = unpack_uhyper(u)
+	o.timeout = unpack_uint(u)
+	o.check()
+	return o
+
+class dsdc_lock_acquire_batch_arg_t(object):
+	__slots__ = [ 'keys', 'writer', 'block', 'timeout' ]
+	def check(self):
+		pass
+		assert self.keys is not None
+		assert self.writer is not None
+		assert self.block is not None
+		assert self.timeout is not None
+	def __eq__(self, other):
+		if not self.keys == other.keys: return 0
+		if not self.writer == other.writer: return 0
+		if not self.block == other.block: return 0
+		if not self.timeout == other.timeout: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_lock_acquire_batch_arg_t(p, o):
+	o.check()
+	p.pack_array(o.keys, lambda x: pack_dsdc_key_t(p, x))
+	pack_bool(p, o.writer)
+	pack_bool(p, o.block)
+	pack_uint(p, o.timeout)
+def unpack_dsdc_lock_acquire_batch_arg_t(u):
+	o = dsdc_lock_acquire_batch_arg_t()
+	o.keys = u.unpack_array(lambda : unpack_dsdc_key_t(u))
+	o.writer = unpack_bool(u)
+	o.block = unpack_bool(u)
+	o.timeout = unpack_uint(u)
+	o.check()
+	return o
+
+class dsdc_lock_acquire_batch_res_t(object):
+	__slots__ = [ 'status', 'lockids', 'err' ]
+	def check(self):
+		pass
+		if self.status == DSDC_OK:
+			assert self.lockids is not None
+		elif self.status == DSDC_RPC_ERROR:
+			assert self.err is not None
+	def __eq__(self, other):
+		if not self.status == other.status: return 0
+		if self.status == DSDC_OK:
+			if not self.lockids == other.lockids: return 0
+		elif self.status == DSDC_RPC_ERROR:
+			if not self.err == other.err: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_lock_acquire_batch_res_t(p, o):
+	o.check()
+	pack_dsdc_res_t(p, o.status)
+	if o.status == DSDC_OK:
+		p.pack_array(o.lockids, lambda x: pack_uhyper(p, x))
+	elif o.status == DSDC_RPC_ERROR:
+		pack_uint(p, o.err)
+def unpack_dsdc_lock_acquire_batch_res_t(u):
+	o = dsdc_lock_acquire_batch_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	if o.status == DSDC_OK:
+		o.lockids = u.unpack_array(lambda : unpack_uhyper(u))
+	elif o.status == DSDC_RPC_ERROR:
+		o.err = unpack_uint(u)
+	o.check()
+	return o
+
+class dsdc_lock_release_batch_arg_t(object):
+	__slots__ = [ 'locks' ]
+	def check(self):
+		pass
+		assert self.locks is not None
+	def __eq__(self, other):
+		if not self.locks == other.locks: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_lock_release_batch_arg_t(p, o):
+	o.check()
+	p.pack_array(o.locks, lambda x: pack_dsdc_lock_release_arg_t(p, x))
+def unpack_dsdc_lock_release_batch_arg_t(u):
+	o = dsdc_lock_release_batch_arg_t()
+	o.locks = u.unpack_array(lambda : unpack_dsdc_lock_release_arg_t(u))
+	o.check()
+	return o
+
+def pack_dsdc_lock_repl_op_type_t(p, o):
+	p.pack_uint(o)
+def unpack_dsdc_lock_repl_op_type_t(u):
+	return u.unpack_uint()
+
+DSDC_LOCK_REPL_GRANT = 0
+DSDC_LOCK_REPL_RELEASE = 1
+DSDC_LOCK_REPL_RENEW = 2
+
+class dsdc_lock_repl_op_t(object):
+	__slots__ = [ 'typ', 'key', 'lockid', 'writer', 'timeout' ]
+	def check(self):
+		pass
+		assert self.typ is not None
+		assert self.key is not None
+		assert self.lockid is not None
+		assert self.writer is not None
+		assert self.timeout is not None
+	def __eq__(self, other):
+		if not self.typ == other.typ: return 0
+		if not self.key == other.key: return 0
+		if not self.lockid == other.lockid: return 0
+		if not self.writer == other.writer: return 0
+		if not self.timeout == other.timeout: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_dsdc_lock_repl_op_t(p, o):
+	o.check()
+	pack_dsdc_lock_repl_op_type_t(p, o.typ)
+	pack_dsdc_key_t(p, o.key)
+	pack_uhyper(p, o.lockid)
+	pack_bool(p, o.writer)
+	pack_uint(p, o.timeout)
+def unpack_dsdc_lock_repl_op_t(u):
+	o = dsdc_lock_repl_op_t()
+	o.typ = unpack_dsdc_lock_repl_op_type_t(u)
 	o.key = unpack_dsdc_key_t(u)
-	o.obj = unpack_dsdc_obj_t(u)
-	o.annotation = unpack_dsdc_annotation_t(u)
+	o.lockid = unpack_uhyper(u)
+	o.writer = unpack_bool(u)
+	o.timeout = unpack_uint(u)
 	o.check()
 	return o
 
-class dsdcx_slave_t(object):
-	__slots__ = [ 'keys', 'hostname', 'port' ]
+class dsdc_lock_repl_arg_t(object):
+	__slots__ = [ 'reset', 'keys', 'ops' ]
 	def check(self):
 		pass
+		assert self.reset is not None
 		assert self.keys is not None
-		assert self.hostname is not None
-		assert self.port is not None
+		assert self.ops is not None
 	def __eq__(self, other):
+		if not self.reset == other.reset: return 0
 		if not self.keys == other.keys: return 0
-		if not self.hostname == other.hostname: return 0
-		if not self.port == other.port: return 0
+		if not self.ops == other.ops: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdcx_slave_t(p, o):
+def pack_dsdc_lock_repl_arg_t(p, o):
 	o.check()
+	pack_bool(p, o.reset)
 	pack_dsdc_keyset_t(p, o.keys)
-	p.pack_string(o.hostname)
-	pack_int32_t(p, o.port)
-def unpack_dsdcx_slave_t(u):
-	o = dsdcx_slave_t()
+	p.pack_array(o.ops, lambda x: pack_dsdc_lock_repl_op_t(p, x))
+def unpack_dsdc_lock_repl_arg_t(u):
+	o = dsdc_lock_repl_arg_t()
+	o.reset = unpack_bool(u)
 	o.keys = unpack_dsdc_keyset_t(u)
-	o.hostname = u.unpack_string()
-	o.port = unpack_int32_t(u)
+	o.ops = u.unpack_array(lambda : unpack_dsdc_lock_repl_op_t(u))
 	o.check()
 	return o
 
-class dsdcx_state_t(object):
-	__slots__ = [ 'slaves', 'lock_server' ]
+class dsdc_lock_ns_stats_t(object):
+	__slots__ = [ 'ns', 'acquires', 'waits', 'timeouts', 'wait_ms', 'hold_ms' ]
 	def check(self):
 		pass
-		assert self.slaves is not None
+		assert self.ns is not None
+		assert self.acquires is not None
+		assert self.waits is not None
+		assert self.timeouts is not None
+		assert self.wait_ms is not None
+		assert self.hold_ms is not None
 	def __eq__(self, other):
-		if not self.slaves == other.slaves: return 0
+		if not self.ns == other.ns: return 0
+		if not self.acquires == other.acquires: return 0
+		if not self.waits == other.waits: return 0
+		if not self.timeouts == other.timeouts: return 0
+		if not self.wait_ms == other.wait_ms: return 0
+		if not self.hold_ms == other.hold_ms: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdcx_state_t(p, o):
+def pack_dsdc_lock_ns_stats_t(p, o):
 	o.check()
-	p.pack_array(o.slaves, lambda x: pack_dsdcx_slave_t(p, x))
-	pack_ptr(p, o.lock_server, lambda x: pack_dsdcx_slave_t(p, x))
-def unpack_dsdcx_state_t(u):
-	o = dsdcx_state_t()
-	o.slaves = u.unpack_array(lambda : unpack_dsdcx_slave_t(u))
-	o.lock_server = unpack_ptr(u, lambda : unpack_dsdcx_slave_t(u))
+	pack_uint(p, o.ns)
+	pack_hyper(p, o.acquires)
+	pack_hyper(p, o.waits)
+	pack_hyper(p, o.timeouts)
+	pack_dsdc_histogram2_t(p, o.wait_ms)
+	pack_dsdc_histogram2_t(p, o.hold_ms)
+def unpack_dsdc_lock_ns_stats_t(u):
+	o = dsdc_lock_ns_stats_t()
+	o.ns = unpack_uint(u)
+	o.acquires = unpack_hyper(u)
+	o.waits = unpack_hyper(u)
+	o.timeouts = unpack_hyper(u)
+	o.wait_ms = unpack_dsdc_histogram2_t(u)
+	o.hold_ms = unpack_dsdc_histogram2_t(u)
 	o.check()
 	return o
 
-class dsdc_register_arg_t(object):
-	__slots__ = [ 'slave', 'primary', 'lock_server' ]
+class dsdc_get_lock_stats_arg_t(object):
+	__slots__ = [ 'n_buckets', 'reset' ]
 	def check(self):
 		pass
-		assert self.slave is not None
-		assert self.primary is not None
-		assert self.lock_server is not None
+		assert self.n_buckets is not None
+		assert self.reset is not None
 	def __eq__(self, other):
-		if not self.slave == other.slave: return 0
-		if not self.primary == other.primary: return 0
-		if not self.lock_server == other.lock_server: return 0
+		if not self.n_buckets == other.n_buckets: return 0
+		if not self.reset == other.reset: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdc_register_arg_t(p, o):
+def pack_dsdc_get_lock_stats_arg_t(p, o):
 	o.check()
-	pack_dsdcx_slave_t(p, o.slave)
-	pack_bool(p, o.primary)
-	pack_bool(p, o.lock_server)
-def unpack_dsdc_register_arg_t(u):
-	o = dsdc_register_arg_t()
-	o.slave = unpack_dsdcx_slave_t(u)
-	o.primary = unpack_bool(u)
-	o.lock_server = unpack_bool(u)
+	pack_uint(p, o.n_buckets)
+	pack_bool(p, o.reset)
+def unpack_dsdc_get_lock_stats_arg_t(u):
+	o = dsdc_get_lock_stats_arg_t()
+	o.n_buckets = unpack_uint(u)
+	o.reset = unpack_bool(u)
 	o.check()
 	return o
 
-class dsdc_getstate_res_t(object):
-	__slots__ = [ 'needupdate', 'state' ]
+class dsdc_get_lock_stats_res_t(object):
+	__slots__ = [ 'status', 'stats' ]
 	def check(self):
 		pass
-		assert self.needupdate is not None
-		if self.needupdate == true:
-			assert self.state is not None
+		if self.status == DSDC_OK:
+			assert self.stats is not None
 	def __eq__(self, other):
-		if not self.needupdate == other.needupdate: return 0
-		if self.needupdate == true:
-			if not self.state == other.state: return 0
+		if not self.status == other.status: return 0
+		if self.status == DSDC_OK:
+			if not self.stats == other.stats: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdc_getstate_res_t(p, o):
+def pack_dsdc_get_lock_stats_res_t(p, o):
 	o.check()
-	pack_bool(p, o.needupdate)
-	if o.needupdate == true:
-		pack_dsdcx_state_t(p, o.state)
-def unpack_dsdc_getstate_res_t(u):
-	o = dsdc_getstate_res_t()
-	o.needupdate = unpack_bool(u)
-	if o.needupdate == true:
-		o.state = unpack_dsdcx_state_t(u)
+	pack_dsdc_res_t(p, o.status)
+	if o.status == DSDC_OK:
+		p.pack_array(o.stats, lambda x: pack_dsdc_lock_ns_stats_t(p, x))
+def unpack_dsdc_get_lock_stats_res_t(u):
+	o = dsdc_get_lock_stats_res_t()
+	o.status = unpack_dsdc_res_t(u)
+	if o.status == DSDC_OK:
+		o.stats = u.unpack_array(lambda : unpack_dsdc_lock_ns_stats_t(u))
 	o.check()
 	return o
 
-class dsdc_lock_acquire_res_t(object):
-	__slots__ = [ 'status', 'lockid', 'err' ]
+def pack_aiod_file_t(p, o):
+	p.pack_string(o)
+def unpack_aiod_file_t(u):
+	return u.unpack_string()
+
+def pack_aiod_files_t(p, o):
+	p.pack_array(o, lambda x: pack_aiod_file_t(p, x))
+def unpack_aiod_files_t(u):
+	return u.unpack_array(lambda : unpack_aiod_file_t(u))
+
+class aiod_str_to_file_arg_t(object):
+	__slots__ = [ 'file', 'data', 'flags', 'mode', 'sync', 'canfail', 'atomic' ]
 	def check(self):
 		pass
-		if self.status == DSDC_OK:
-			assert self.lockid is not None
-		elif self.status == DSDC_RPC_ERROR:
-			assert self.err is not None
+		assert self.file is not None
+		assert self.data is not None
+		assert self.flags is not None
+		assert self.mode is not None
+		assert self.sync is not None
+		assert self.canfail is not None
+		assert self.atomic is not None
 	def __eq__(self, other):
-		if not self.status == other.status: return 0
-		if self.status == DSDC_OK:
-			if not self.lockid == other.lockid: return 0
-		elif self.status == DSDC_RPC_ERROR:
-			if not self.err == other.err: return 0
+		if not self.file == other.file: return 0
+		if not self.data == other.data: return 0
+		if not self.flags == other.flags: return 0
+		if not self.mode == other.mode: return 0
+		if not self.sync == other.sync: return 0
+		if not self.canfail == other.canfail: return 0
+		if not self.atomic == other.atomic: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdc_lock_acquire_res_t(p, o):
+def pack_aiod_str_to_file_arg_t(p, o):
 	o.check()
-	pack_dsdc_res_t(p, o.status)
-	if o.status == DSDC_OK:
-		pack_u_int64_t(p, o.lockid)
-	elif o.status == DSDC_RPC_ERROR:
-		pack_u_int32_t(p, o.err)
-def unpack_dsdc_lock_acquire_res_t(u):
-	o = dsdc_lock_acquire_res_t()
-	o.status = unpack_dsdc_res_t(u)
-	if o.status == DSDC_OK:
-		o.lockid = unpack_u_int64_t(u)
-	elif o.status == DSDC_RPC_ERROR:
-		o.err = unpack_u_int32_t(u)
+	pack_aiod_file_t(p, o.file)
+	p.pack_opaque(o.data)
+	pack_int(p, o.flags)
+	pack_int(p, o.mode)
+	pack_bool(p, o.sync)
+	pack_bool(p, o.canfail)
+	pack_bool(p, o.atomic)
+def unpack_aiod_str_to_file_arg_t(u):
+	o = aiod_str_to_file_arg_t()
+	o.file = unpack_aiod_file_t(u)
+	o.data = u.unpack_opaque()
+	o.flags = unpack_int(u)
+	o.mode = unpack_int(u)
+	o.sync = unpack_bool(u)
+	o.canfail = unpack_bool(u)
+	o.atomic = unpack_bool(u)
 	o.check()
 	return o
 
-class dsdc_lock_acquire_arg_t(object):
-	__slots__ = [ 'key', 'writer', 'block', 'timeout' ]
+class aiod_file_to_str_res_t(object):
+	__slots__ = [ 'code', 'data' ]
 	def check(self):
 		pass
-		assert self.key is not None
-		assert self.writer is not None
-		assert self.block is not None
-		assert self.timeout is not None
+		if self.code == 0:
+			assert self.data is not None
 	def __eq__(self, other):
-		if not self.key == other.key: return 0
-		if not self.writer == other.writer: return 0
-		if not self.block == other.block: return 0
-		if not self.timeout == other.timeout: return 0
+		if not self.code == other.code: return 0
+		if self.code == 0:
+			if not self.data == other.data: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdc_lock_acquire_arg_t(p, o):
+def pack_aiod_file_to_str_res_t(p, o):
 	o.check()
-	pack_dsdc_key_t(p, o.key)
-	pack_bool(p, o.writer)
-	pack_bool(p, o.block)
-	pack_u_int32_t(p, o.timeout)
-def unpack_dsdc_lock_acquire_arg_t(u):
-	o = dsdc_lock_acquire_arg_t()
-	o.key = unpack_dsdc_key_t(u)
-	o.writer = unpack_bool(u)
-	o.block = unpack_bool(u)
-	o.timeout = unpack_u_int32_t(u)
+	pack_int(p, o.code)
+	if o.code == 0:
+		p.pack_opaque(o.data)
+def unpack_aiod_file_to_str_res_t(u):
+	o = aiod_file_to_str_res_t()
+	o.code = unpack_int(u)
+	if o.code == 0:
+		o.data = u.unpack_opaque()
 	o.check()
 	return o
 
-class dsdc_lock_release_arg_t(object):
-	__slots__ = [ 'key', 'lockid' ]
+class aiod_mkdir_arg_t(object):
+	__slots__ = [ 'file', 'mode' ]
 	def check(self):
 		pass
-		assert self.key is not None
-		assert self.lockid is not None
+		assert self.file is not None
+		assert self.mode is not None
 	def __eq__(self, other):
-		if not self.key == other.key: return 0
-		if not self.lockid == other.lockid: return 0
+		if not self.file == other.file: return 0
+		if not self.mode == other.mode: return 0
 		return 1
 	def __ne__(self, other):
 		return not self == other
-def pack_dsdc_lock_release_arg_t(p, o):
+def pack_aiod_mkdir_arg_t(p, o):
 	o.check()
-	pack_dsdc_key_t(p, o.key)
-	pack_u_int64_t(p, o.lockid)
-def unpack_dsdc_lock_release_arg_t(u):
-	o = dsdc_lock_release_arg_t()
-	o.key = unpack_dsdc_key_t(u)
-	o.lockid = unpack_u_int64_t(u)
+	pack_aiod_file_t(p, o.file)
+	pack_int(p, o.mode)
+def unpack_aiod_mkdir_arg_t(u):
+	o = aiod_mkdir_arg_t()
+	o.file = unpack_aiod_file_t(u)
+	o.mode = unpack_int(u)
+	o.check()
+	return o
+
+class aiod_glob_res_t(object):
+	__slots__ = [ 'code', 'files' ]
+	def check(self):
+		pass
+		if self.code == 0:
+			assert self.files is not None
+	def __eq__(self, other):
+		if not self.code == other.code: return 0
+		if self.code == 0:
+			if not self.files == other.files: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_aiod_glob_res_t(p, o):
+	o.check()
+	pack_int(p, o.code)
+	if o.code == 0:
+		pack_aiod_files_t(p, o.files)
+def unpack_aiod_glob_res_t(u):
+	o = aiod_glob_res_t()
+	o.code = unpack_int(u)
+	if o.code == 0:
+		o.files = unpack_aiod_files_t(u)
+	o.check()
+	return o
+
+class aiod_glob_arg_t(object):
+	__slots__ = [ 'dir', 'pattern' ]
+	def check(self):
+		pass
+		assert self.dir is not None
+		assert self.pattern is not None
+	def __eq__(self, other):
+		if not self.dir == other.dir: return 0
+		if not self.pattern == other.pattern: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_aiod_glob_arg_t(p, o):
+	o.check()
+	pack_aiod_file_t(p, o.dir)
+	pack_aiod_file_t(p, o.pattern)
+def unpack_aiod_glob_arg_t(u):
+	o = aiod_glob_arg_t()
+	o.dir = unpack_aiod_file_t(u)
+	o.pattern = unpack_aiod_file_t(u)
+	o.check()
+	return o
+
+class aiod_statvfs_t(object):
+	__slots__ = [ 'aiod_f_bsize', 'aiod_f_frsize', 'aiod_f_blocks', 'aiod_f_bfree', 'aiod_f_bavail', 'aiod_f_files', 'aiod_f_ffree', 'aiod_f_favail', 'aiod_f_fsid', 'aiod_f_flag', 'aiod_f_namemax' ]
+	def check(self):
+		pass
+		assert self.aiod_f_bsize is not None
+		assert self.aiod_f_frsize is not None
+		assert self.aiod_f_blocks is not None
+		assert self.aiod_f_bfree is not None
+		assert self.aiod_f_bavail is not None
+		assert self.aiod_f_files is not None
+		assert self.aiod_f_ffree is not None
+		assert self.aiod_f_favail is not None
+		assert self.aiod_f_fsid is not None
+		assert self.aiod_f_flag is not None
+		assert self.aiod_f_namemax is not None
+	def __eq__(self, other):
+		if not self.aiod_f_bsize == other.aiod_f_bsize: return 0
+		if not self.aiod_f_frsize == other.aiod_f_frsize: return 0
+		if not self.aiod_f_blocks == other.aiod_f_blocks: return 0
+		if not self.aiod_f_bfree == other.aiod_f_bfree: return 0
+		if not self.aiod_f_bavail == other.aiod_f_bavail: return 0
+		if not self.aiod_f_files == other.aiod_f_files: return 0
+		if not self.aiod_f_ffree == other.aiod_f_ffree: return 0
+		if not self.aiod_f_favail == other.aiod_f_favail: return 0
+		if not self.aiod_f_fsid == other.aiod_f_fsid: return 0
+		if not self.aiod_f_flag == other.aiod_f_flag: return 0
+		if not self.aiod_f_namemax == other.aiod_f_namemax: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_aiod_statvfs_t(p, o):
+	o.check()
+	pack_uhyper(p, o.aiod_f_bsize)
+	pack_uhyper(p, o.aiod_f_frsize)
+	pack_uhyper(p, o.aiod_f_blocks)
+	pack_uhyper(p, o.aiod_f_bfree)
+	pack_uhyper(p, o.aiod_f_bavail)
+	pack_uhyper(p, o.aiod_f_files)
+	pack_uhyper(p, o.aiod_f_ffree)
+	pack_uhyper(p, o.aiod_f_favail)
+	pack_uhyper(p, o.aiod_f_fsid)
+	pack_uhyper(p, o.aiod_f_flag)
+	pack_uhyper(p, o.aiod_f_namemax)
+def unpack_aiod_statvfs_t(u):
+	o = aiod_statvfs_t()
+	o.aiod_f_bsize = unpack_uhyper(u)
+	o.aiod_f_frsize = unpack_uhyper(u)
+	o.aiod_f_blocks = unpack_uhyper(u)
+	o.aiod_f_bfree = unpack_uhyper(u)
+	o.aiod_f_bavail = unpack_uhyper(u)
+	o.aiod_f_files = unpack_uhyper(u)
+	o.aiod_f_ffree = unpack_uhyper(u)
+	o.aiod_f_favail = unpack_uhyper(u)
+	o.aiod_f_fsid = unpack_uhyper(u)
+	o.aiod_f_flag = unpack_uhyper(u)
+	o.aiod_f_namemax = unpack_uhyper(u)
+	o.check()
+	return o
+
+class aiod_stat_t(object):
+	__slots__ = [ 'aiod_st_dev', 'aiod_st_ino', 'aiod_st_mode', 'aiod_st_nlink', 'aiod_st_uid', 'aiod_st_gid', 'aiod_st_rdev', 'aiod_st_size', 'aiod_st_blksize', 'aiod_st_blocks', 'aiod_st_atime', 'aiod_st_mtime', 'aiod_st_ctime' ]
+	def check(self):
+		pass
+		assert self.aiod_st_dev is not None
+		assert self.aiod_st_ino is not None
+		assert self.aiod_st_mode is not None
+		assert self.aiod_st_nlink is not None
+		assert self.aiod_st_uid is not None
+		assert self.aiod_st_gid is not None
+		assert self.aiod_st_rdev is not None
+		assert self.aiod_st_size is not None
+		assert self.aiod_st_blksize is not None
+		assert self.aiod_st_blocks is not None
+		assert self.aiod_st_atime is not None
+		assert self.aiod_st_mtime is not None
+		assert self.aiod_st_ctime is not None
+	def __eq__(self, other):
+		if not self.aiod_st_dev == other.aiod_st_dev: return 0
+		if not self.aiod_st_ino == other.aiod_st_ino: return 0
+		if not self.aiod_st_mode == other.aiod_st_mode: return 0
+		if not self.aiod_st_nlink == other.aiod_st_nlink: return 0
+		if not self.aiod_st_uid == other.aiod_st_uid: return 0
+		if not self.aiod_st_gid == other.aiod_st_gid: return 0
+		if not self.aiod_st_rdev == other.aiod_st_rdev: return 0
+		if not self.aiod_st_size == other.aiod_st_size: return 0
+		if not self.aiod_st_blksize == other.aiod_st_blksize: return 0
+		if not self.aiod_st_blocks == other.aiod_st_blocks: return 0
+		if not self.aiod_st_atime == other.aiod_st_atime: return 0
+		if not self.aiod_st_mtime == other.aiod_st_mtime: return 0
+		if not self.aiod_st_ctime == other.aiod_st_ctime: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_aiod_stat_t(p, o):
+	o.check()
+	pack_uhyper(p, o.aiod_st_dev)
+	pack_uhyper(p, o.aiod_st_ino)
+	pack_uhyper(p, o.aiod_st_mode)
+	pack_uhyper(p, o.aiod_st_nlink)
+	pack_uhyper(p, o.aiod_st_uid)
+	pack_uhyper(p, o.aiod_st_gid)
+	pack_uhyper(p, o.aiod_st_rdev)
+	pack_uhyper(p, o.aiod_st_size)
+	pack_uhyper(p, o.aiod_st_blksize)
+	pack_uhyper(p, o.aiod_st_blocks)
+	pack_uhyper(p, o.aiod_st_atime)
+	pack_uhyper(p, o.aiod_st_mtime)
+	pack_uhyper(p, o.aiod_st_ctime)
+def unpack_aiod_stat_t(u):
+	o = aiod_stat_t()
+	o.aiod_st_dev = unpack_uhyper(u)
+	o.aiod_st_ino = unpack_uhyper(u)
+	o.aiod_st_mode = unpack_uhyper(u)
+	o.aiod_st_nlink = unpack_uhyper(u)
+	o.aiod_st_uid = unpack_uhyper(u)
+	o.aiod_st_gid = unpack_uhyper(u)
+	o.aiod_st_rdev = unpack_uhyper(u)
+	o.aiod_st_size = unpack_uhyper(u)
+	o.aiod_st_blksize = unpack_uhyper(u)
+	o.aiod_st_blocks = unpack_uhyper(u)
+	o.aiod_st_atime = unpack_uhyper(u)
+	o.aiod_st_mtime = unpack_uhyper(u)
+	o.aiod_st_ctime = unpack_uhyper(u)
+	o.check()
+	return o
+
+class aiod_stat_res_t(object):
+	__slots__ = [ 'code', 'stat' ]
+	def check(self):
+		pass
+		if self.code == 0:
+			assert self.stat is not None
+	def __eq__(self, other):
+		if not self.code == other.code: return 0
+		if self.code == 0:
+			if not self.stat == other.stat: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_aiod_stat_res_t(p, o):
+	o.check()
+	pack_int(p, o.code)
+	if o.code == 0:
+		pack_aiod_stat_t(p, o.stat)
+def unpack_aiod_stat_res_t(u):
+	o = aiod_stat_res_t()
+	o.code = unpack_int(u)
+	if o.code == 0:
+		o.stat = unpack_aiod_stat_t(u)
+	o.check()
+	return o
+
+class aiod_statvfs_res_t(object):
+	__slots__ = [ 'code', 'stat' ]
+	def check(self):
+		pass
+		if self.code == 0:
+			assert self.stat is not None
+	def __eq__(self, other):
+		if not self.code == other.code: return 0
+		if self.code == 0:
+			if not self.stat == other.stat: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_aiod_statvfs_res_t(p, o):
+	o.check()
+	pack_int(p, o.code)
+	if o.code == 0:
+		pack_aiod_statvfs_t(p, o.stat)
+def unpack_aiod_statvfs_res_t(u):
+	o = aiod_statvfs_res_t()
+	o.code = unpack_int(u)
+	if o.code == 0:
+		o.stat = unpack_aiod_statvfs_t(u)
+	o.check()
+	return o
+
+#define SHA1SZ 20
+def pack_checksum_t(p, o):
+	p.pack_fopaque(SHA1SZ, o)
+def unpack_checksum_t(u):
+	return u.unpack_fopaque(SHA1SZ)
+
+class fscache_file_data_t(object):
+	__slots__ = [ 'timestamp', 'data' ]
+	def check(self):
+		pass
+		assert self.timestamp is not None
+		assert self.data is not None
+	def __eq__(self, other):
+		if not self.timestamp == other.timestamp: return 0
+		if not self.data == other.data: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_fscache_file_data_t(p, o):
+	o.check()
+	pack_uint(p, o.timestamp)
+	p.pack_opaque(o.data)
+def unpack_fscache_file_data_t(u):
+	o = fscache_file_data_t()
+	o.timestamp = unpack_uint(u)
+	o.data = u.unpack_opaque()
+	o.check()
+	return o
+
+class fscache_file_t(object):
+	__slots__ = [ 'checksum', 'data' ]
+	def check(self):
+		pass
+		assert self.checksum is not None
+		assert self.data is not None
+	def __eq__(self, other):
+		if not self.checksum == other.checksum: return 0
+		if not self.data == other.data: return 0
+		return 1
+	def __ne__(self, other):
+		return not self == other
+def pack_fscache_file_t(p, o):
+	o.check()
+	pack_checksum_t(p, o.checksum)
+	pack_fscache_file_data_t(p, o.data)
+def unpack_fscache_file_t(u):
+	o = fscache_file_t()
+	o.checksum = unpack_checksum_t(u)
+	o.data = unpack_fscache_file_data_t(u)
 	o.check()
 	return o
 
@@ -1142,6 +3608,198 @@ proc.pack_arg = pack_dsdc_get_stats_single_arg_t
 proc.unpack_arg = unpack_dsdc_get_stats_single_arg_t
 proc.pack_res = pack_dsdc_get_stats_single_res_t
 proc.unpack_res = unpack_dsdc_get_stats_single_res_t
+DSDC_REMOVE3 = 19
+programs[DSDC_PROG][DSDC_VERS][DSDC_REMOVE3] = proc = Procedure()
+proc.pack_arg = pack_dsdc_remove3_arg_t
+proc.unpack_arg = unpack_dsdc_remove3_arg_t
+proc.pack_res = pack_dsdc_res_t
+proc.unpack_res = unpack_dsdc_res_t
+DSDC_SET_STATS_MODE = 20
+programs[DSDC_PROG][DSDC_VERS][DSDC_SET_STATS_MODE] = proc = Procedure()
+proc.pack_arg = pack_bool
+proc.unpack_arg = unpack_bool
+proc.pack_res = pack_void
+proc.unpack_res = unpack_void
+DSDC_PUT4 = 21
+programs[DSDC_PROG][DSDC_VERS][DSDC_PUT4] = proc = Procedure()
+proc.pack_arg = pack_dsdc_put4_arg_t
+proc.unpack_arg = unpack_dsdc_put4_arg_t
+proc.pack_res = pack_dsdc_res_t
+proc.unpack_res = unpack_dsdc_res_t
+DSDC_GET4 = 22
+programs[DSDC_PROG][DSDC_VERS][DSDC_GET4] = proc = Procedure()
+proc.pack_arg = pack_dsdc_get4_arg_t
+proc.unpack_arg = unpack_dsdc_get4_arg_t
+proc.pack_res = pack_dsdc_get_res_t
+proc.unpack_res = unpack_dsdc_get_res_t
+DSDC_MGET4 = 23
+programs[DSDC_PROG][DSDC_VERS][DSDC_MGET4] = proc = Procedure()
+proc.pack_arg = pack_dsdc_mget4_arg_t
+proc.unpack_arg = unpack_dsdc_mget4_arg_t
+proc.pack_res = pack_dsdc_mget_res_t
+proc.unpack_res = unpack_dsdc_mget_res_t
+DSDC_PUT5 = 24
+programs[DSDC_PROG][DSDC_VERS][DSDC_PUT5] = proc = Procedure()
+proc.pack_arg = pack_dsdc_put5_arg_t
+proc.unpack_arg = unpack_dsdc_put5_arg_t
+proc.pack_res = pack_dsdc_res_t
+proc.unpack_res = unpack_dsdc_res_t
+DSDC_MPUT = 25
+programs[DSDC_PROG][DSDC_VERS][DSDC_MPUT] = proc = Procedure()
+proc.pack_arg = pack_dsdc_mput_arg_t
+proc.unpack_arg = unpack_dsdc_mput_arg_t
+proc.pack_res = pack_dsdc_mput_res_t
+proc.unpack_res = unpack_dsdc_mput_res_t
+DSDC_MREMOVE = 26
+programs[DSDC_PROG][DSDC_VERS][DSDC_MREMOVE] = proc = Procedure()
+proc.pack_arg = pack_dsdc_mremove_arg_t
+proc.unpack_arg = unpack_dsdc_mremove_arg_t
+proc.pack_res = pack_dsdc_mput_res_t
+proc.unpack_res = unpack_dsdc_mput_res_t
+DSDC_FAST_PORT = 27
+programs[DSDC_PROG][DSDC_VERS][DSDC_FAST_PORT] = proc = Procedure()
+proc.pack_arg = pack_void
+proc.unpack_arg = unpack_void
+proc.pack_res = pack_int
+proc.unpack_res = unpack_int
+DSDC_COMPRESSION = 28
+programs[DSDC_PROG][DSDC_VERS][DSDC_COMPRESSION] = proc = Procedure()
+proc.pack_arg = pack_uint
+proc.unpack_arg = unpack_uint
+proc.pack_res = pack_dsdc_compression_res_t
+proc.unpack_res = unpack_dsdc_compression_res_t
+DSDC_LOCK_ACQUIRE_BATCH = 29
+programs[DSDC_PROG][DSDC_VERS][DSDC_LOCK_ACQUIRE_BATCH] = proc = Procedure()
+proc.pack_arg = pack_dsdc_lock_acquire_batch_arg_t
+proc.unpack_arg = unpack_dsdc_lock_acquire_batch_arg_t
+proc.pack_res = pack_dsdc_lock_acquire_batch_res_t
+proc.unpack_res = unpack_dsdc_lock_acquire_batch_res_t
+DSDC_LOCK_RELEASE_BATCH = 30
+programs[DSDC_PROG][DSDC_VERS][DSDC_LOCK_RELEASE_BATCH] = proc = Procedure()
+proc.pack_arg = pack_dsdc_lock_release_batch_arg_t
+proc.unpack_arg = unpack_dsdc_lock_release_batch_arg_t
+proc.pack_res = pack_dsdc_mput_res_t
+proc.unpack_res = unpack_dsdc_mput_res_t
+DSDC_LOCK_RENEW = 31
+programs[DSDC_PROG][DSDC_VERS][DSDC_LOCK_RENEW] = proc = Procedure()
+proc.pack_arg = pack_dsdc_lock_renew_arg_t
+proc.unpack_arg = unpack_dsdc_lock_renew_arg_t
+proc.pack_res = pack_dsdc_res_t
+proc.unpack_res = unpack_dsdc_res_t
+DSDC_PUT6 = 32
+programs[DSDC_PROG][DSDC_VERS][DSDC_PUT6] = proc = Procedure()
+proc.pack_arg = pack_dsdc_put6_arg_t
+proc.unpack_arg = unpack_dsdc_put6_arg_t
+proc.pack_res = pack_dsdc_res_t
+proc.unpack_res = unpack_dsdc_res_t
+DSDC_LOCK_REPLICATE = 33
+programs[DSDC_PROG][DSDC_VERS][DSDC_LOCK_REPLICATE] = proc = Procedure()
+proc.pack_arg = pack_dsdc_lock_repl_arg_t
+proc.unpack_arg = unpack_dsdc_lock_repl_arg_t
+proc.pack_res = pack_dsdc_res_t
+proc.unpack_res = unpack_dsdc_res_t
+DSDC_LOCK_ACQUIRE2 = 34
+programs[DSDC_PROG][DSDC_VERS][DSDC_LOCK_ACQUIRE2] = proc = Procedure()
+proc.pack_arg = pack_dsdc_lock_acquire2_arg_t
+proc.unpack_arg = unpack_dsdc_lock_acquire2_arg_t
+proc.pack_res = pack_dsdc_lock_acquire_res_t
+proc.unpack_res = unpack_dsdc_lock_acquire_res_t
+DSDC_GET_LOCK_STATS = 35
+programs[DSDC_PROG][DSDC_VERS][DSDC_GET_LOCK_STATS] = proc = Procedure()
+proc.pack_arg = pack_dsdc_get_lock_stats_arg_t
+proc.unpack_arg = unpack_dsdc_get_lock_stats_arg_t
+proc.pack_res = pack_dsdc_get_lock_stats_res_t
+proc.unpack_res = unpack_dsdc_get_lock_stats_res_t
+DSDC_ATOMIC = 36
+programs[DSDC_PROG][DSDC_VERS][DSDC_ATOMIC] = proc = Procedure()
+proc.pack_arg = pack_dsdc_atomic_arg_t
+proc.unpack_arg = unpack_dsdc_atomic_arg_t
+proc.pack_res = pack_dsdc_atomic_res_t
+proc.unpack_res = unpack_dsdc_atomic_res_t
+DSDC_GET_LATENCY_STATS = 37
+programs[DSDC_PROG][DSDC_VERS][DSDC_GET_LATENCY_STATS] = proc = Procedure()
+proc.pack_arg = pack_dsdc_get_latency_stats_arg_t
+proc.unpack_arg = unpack_dsdc_get_latency_stats_arg_t
+proc.pack_res = pack_dsdc_get_latency_stats_res_t
+proc.unpack_res = unpack_dsdc_get_latency_stats_res_t
+DSDC_GET_HOTKEYS = 38
+programs[DSDC_PROG][DSDC_VERS][DSDC_GET_HOTKEYS] = proc = Procedure()
+proc.pack_arg = pack_dsdc_get_hotkeys_arg_t
+proc.unpack_arg = unpack_dsdc_get_hotkeys_arg_t
+proc.pack_res = pack_dsdc_get_hotkeys_res_t
+proc.unpack_res = unpack_dsdc_get_hotkeys_res_t
+DSDC_GET_MRC = 39
+programs[DSDC_PROG][DSDC_VERS][DSDC_GET_MRC] = proc = Procedure()
+proc.pack_arg = pack_dsdc_get_mrc_arg_t
+proc.unpack_arg = unpack_dsdc_get_mrc_arg_t
+proc.pack_res = pack_dsdc_get_mrc_res_t
+proc.unpack_res = unpack_dsdc_get_mrc_res_t
+DSDC_GET_STATS_AGG = 40
+programs[DSDC_PROG][DSDC_VERS][DSDC_GET_STATS_AGG] = proc = Procedure()
+proc.pack_arg = pack_dsdc_get_stats_agg_arg_t
+proc.unpack_arg = unpack_dsdc_get_stats_agg_arg_t
+proc.pack_res = pack_dsdc_get_stats_agg_res_t
+proc.unpack_res = unpack_dsdc_get_stats_agg_res_t
+DSDC_GET5 = 41
+programs[DSDC_PROG][DSDC_VERS][DSDC_GET5] = proc = Procedure()
+proc.pack_arg = pack_dsdc_get5_arg_t
+proc.unpack_arg = unpack_dsdc_get5_arg_t
+proc.pack_res = pack_dsdc_get_res_t
+proc.unpack_res = unpack_dsdc_get_res_t
+DSDC_PUT7 = 42
+programs[DSDC_PROG][DSDC_VERS][DSDC_PUT7] = proc = Procedure()
+proc.pack_arg = pack_dsdc_put7_arg_t
+proc.unpack_arg = unpack_dsdc_put7_arg_t
+proc.pack_res = pack_dsdc_res_t
+proc.unpack_res = unpack_dsdc_res_t
+DSDC_GET_TRACES = 43
+programs[DSDC_PROG][DSDC_VERS][DSDC_GET_TRACES] = proc = Procedure()
+proc.pack_arg = pack_dsdc_get_traces_arg_t
+proc.unpack_arg = unpack_dsdc_get_traces_arg_t
+proc.pack_res = pack_dsdc_get_traces_res_t
+proc.unpack_res = unpack_dsdc_get_traces_res_t
+DSDC_GET_PROFILE = 44
+programs[DSDC_PROG][DSDC_VERS][DSDC_GET_PROFILE] = proc = Procedure()
+proc.pack_arg = pack_void
+proc.unpack_arg = unpack_void
+proc.pack_res = pack_dsdc_get_profile_res_t
+proc.unpack_res = unpack_dsdc_get_profile_res_t
+DSDC_GET_LOOP_STATS = 45
+programs[DSDC_PROG][DSDC_VERS][DSDC_GET_LOOP_STATS] = proc = Procedure()
+proc.pack_arg = pack_dsdc_get_loop_stats_arg_t
+proc.unpack_arg = unpack_dsdc_get_loop_stats_arg_t
+proc.pack_res = pack_dsdc_get_loop_stats_res_t
+proc.unpack_res = unpack_dsdc_get_loop_stats_res_t
+DSDC_PUTZ = 46
+programs[DSDC_PROG][DSDC_VERS][DSDC_PUTZ] = proc = Procedure()
+proc.pack_arg = pack_dsdc_putz_arg_t
+proc.unpack_arg = unpack_dsdc_putz_arg_t
+proc.pack_res = pack_dsdc_res_t
+proc.unpack_res = unpack_dsdc_res_t
+DSDC_PUT_MANIFEST = 47
+programs[DSDC_PROG][DSDC_VERS][DSDC_PUT_MANIFEST] = proc = Procedure()
+proc.pack_arg = pack_dsdc_put6_arg_t
+proc.unpack_arg = unpack_dsdc_put6_arg_t
+proc.pack_res = pack_dsdc_res_t
+proc.unpack_res = unpack_dsdc_res_t
+DSDC_GET_MANIFEST = 48
+programs[DSDC_PROG][DSDC_VERS][DSDC_GET_MANIFEST] = proc = Procedure()
+proc.pack_arg = pack_dsdc_key_t
+proc.unpack_arg = unpack_dsdc_key_t
+proc.pack_res = pack_dsdc_get_res_t
+proc.unpack_res = unpack_dsdc_get_res_t
+DSDC_GETSTATE2 = 49
+programs[DSDC_PROG][DSDC_VERS][DSDC_GETSTATE2] = proc = Procedure()
+proc.pack_arg = pack_dsdc_key_t
+proc.unpack_arg = unpack_dsdc_key_t
+proc.pack_res = pack_dsdc_getstate2_res_t
+proc.unpack_res = unpack_dsdc_getstate2_res_t
+DSDC_GET_STATS_SINGLE2 = 50
+programs[DSDC_PROG][DSDC_VERS][DSDC_GET_STATS_SINGLE2] = proc = Procedure()
+proc.pack_arg = pack_dsdc_get_stats_single_arg_t
+proc.unpack_arg = unpack_dsdc_get_stats_single_arg_t
+proc.pack_res = pack_dsdc_get_stats_single2_res_t
+proc.unpack_res = unpack_dsdc_get_stats_single2_res_t
 DSDC_COMPUTE_MATCHES = 100
 programs[DSDC_PROG][DSDC_VERS][DSDC_COMPUTE_MATCHES] = proc = Procedure()
 proc.pack_arg = pack_matchd_frontd_dcdc_arg_t
@@ -1149,3 +3807,56 @@ proc.unpack_arg = unpack_matchd_frontd_dcdc_arg_t
 proc.pack_res = pack_match_frontd_match_results_t
 proc.unpack_res = unpack_match_frontd_match_results_t
 
+AIOD_PROG = 30003
+programs[AIOD_PROG] = {}
+AIOD_VERS = 2
+programs[AIOD_PROG][AIOD_VERS] = {}
+AIOD2_NULL = 0
+programs[AIOD_PROG][AIOD_VERS][AIOD2_NULL] = proc = Procedure()
+proc.pack_arg = pack_void
+proc.unpack_arg = unpack_void
+proc.pack_res = pack_void
+proc.unpack_res = unpack_void
+AIOD2_STR_TO_FILE = 1
+programs[AIOD_PROG][AIOD_VERS][AIOD2_STR_TO_FILE] = proc = Procedure()
+proc.pack_arg = pack_aiod_str_to_file_arg_t
+proc.unpack_arg = unpack_aiod_str_to_file_arg_t
+proc.pack_res = pack_int
+proc.unpack_res = unpack_int
+AIOD2_FILE_TO_STR = 2
+programs[AIOD_PROG][AIOD_VERS][AIOD2_FILE_TO_STR] = proc = Procedure()
+proc.pack_arg = pack_aiod_file_t
+proc.unpack_arg = unpack_aiod_file_t
+proc.pack_res = pack_aiod_file_to_str_res_t
+proc.unpack_res = unpack_aiod_file_to_str_res_t
+AIOD2_REMOVE = 3
+programs[AIOD_PROG][AIOD_VERS][AIOD2_REMOVE] = proc = Procedure()
+proc.pack_arg = pack_aiod_file_t
+proc.unpack_arg = unpack_aiod_file_t
+proc.pack_res = pack_int
+proc.unpack_res = unpack_int
+AIOD2_MKDIR = 4
+programs[AIOD_PROG][AIOD_VERS][AIOD2_MKDIR] = proc = Procedure()
+proc.pack_arg = pack_aiod_mkdir_arg_t
+proc.unpack_arg = unpack_aiod_mkdir_arg_t
+proc.pack_res = pack_int
+proc.unpack_res = unpack_int
+AIOD2_STATVFS = 5
+programs[AIOD_PROG][AIOD_VERS][AIOD2_STATVFS] = proc = Procedure()
+proc.pack_arg = pack_aiod_file_t
+proc.unpack_arg = unpack_aiod_file_t
+proc.pack_res = pack_aiod_statvfs_res_t
+proc.unpack_res = unpack_aiod_statvfs_res_t
+AIOD2_STAT = 6
+programs[AIOD_PROG][AIOD_VERS][AIOD2_STAT] = proc = Procedure()
+proc.pack_arg = pack_aiod_file_t
+proc.unpack_arg = unpack_aiod_file_t
+proc.pack_res = pack_aiod_stat_res_t
+proc.unpack_res = unpack_aiod_stat_res_t
+AIOD2_GLOB = 7
+programs[AIOD_PROG][AIOD_VERS][AIOD2_GLOB] = proc = Procedure()
+proc.pack_arg = pack_aiod_glob_arg_t
+proc.unpack_arg = unpack_aiod_glob_arg_t
+proc.pack_res = pack_aiod_glob_res_t
+proc.unpack_res = unpack_aiod_glob_res_t
+